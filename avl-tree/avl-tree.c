@@ -8,6 +8,17 @@
 
 #define MAXELEMENTSIZE 500000
 
+#ifdef ALLOC_ARENA
+#define TREE_ARENA_SIZE 4096
+static uint8_t TreeArenaBuf[TREE_ARENA_SIZE];
+libmin_arena_t TreeArena;
+#endif /* ALLOC_ARENA */
+
+#ifdef ALLOC_POOL
+#define TREE_POOL_SIZE  32
+libmin_pool_t TreeNodePool;
+#endif /* ALLOC_POOL */
+
 void printTree(TreeNode *start, long level)
 {
     long i = 0;
@@ -49,19 +60,27 @@ int main(int argc, char** argv)
     topsize = 25;
     tick = topsize / 20;
     
+#ifdef ALLOC_ARENA
+    libmin_arena_init(&TreeArena, TreeArenaBuf, TREE_ARENA_SIZE);
+#endif /* ALLOC_ARENA */
+#ifdef ALLOC_POOL
+    if (!libmin_pool_init(&TreeNodePool, sizeof(TreeNode), TREE_POOL_SIZE))
+        libmin_fail(1);
+#endif /* ALLOC_POOL */
+
     libmin_srand(42);
     libmin_printf("Start  -->  Finished\n");
     for(i = 0; i < topsize; i++) {
-        newItem = libmin_malloc(sizeof(Element));
-        itemName = libmin_malloc(sizeof(char) * 11);
+        newItem = TreeAlloc(sizeof(Element));
+        itemName = TreeAlloc(sizeof(char) * 11);
         libmin_snprintf(itemName, 11, "Name%ld", i);
         do  {
             *newItem = libmin_rand();
             newTree = Insert(tree, newItem, itemName);
             if(newTree == NULL) {
                 if(last == *newItem)    {
-                    libmin_free(itemName);
-                    libmin_free(newItem);
+                    TreeFree(itemName);
+                    TreeFree(newItem);
                     libmin_printf("going to try and skip: %ld\n", *newItem);
                     break;
                 } else
@@ -155,6 +174,12 @@ int main(int argc, char** argv)
     }
     
     MakeEmpty(tree);
+#ifdef ALLOC_ARENA
+    libmin_arena_destroy(&TreeArena);
+#endif /* ALLOC_ARENA */
+#ifdef ALLOC_POOL
+    libmin_pool_destroy(&TreeNodePool);
+#endif /* ALLOC_POOL */
 
     libmin_success();
     return 0;
@@ -133,7 +133,7 @@ TreeNode *InsertNode(TreeNode *tnode, Element Item,
     
     if(tnode == NULL)    {
         /* found the spot that the TreeNode belongs */
-        tnode = libmin_malloc(sizeof(TreeNode));
+        tnode = TreeNodeAlloc();
         /* malloc problem, return NULL */
         if(tnode == NULL)
             return NULL;
@@ -197,8 +197,8 @@ void MakeEmpty(TreeNode *rootNode)
     MakeEmpty(rootNode->Left);
     MakeEmpty(rootNode->Right);
     FreeElement(rootNode->Item);
-    libmin_free(rootNode->Name);
-    libmin_free(rootNode);
+    TreeFree(rootNode->Name);
+    TreeNodeFree(rootNode);
 }
 
 TreeNode *DeleteLeftMost(TreeNode **deletedNode, TreeNode *rootNode,
@@ -210,11 +210,11 @@ TreeNode *DeleteLeftMost(TreeNode **deletedNode, TreeNode *rootNode,
         return NULL;
     }
     if(rootNode->Left == NULL)  {
-        libmin_free((*deletedNode)->Name);
+        TreeFree((*deletedNode)->Name);
         FreeElement((*deletedNode)->Item);
         (*deletedNode)->Name = rootNode->Name;
         (*deletedNode)->Item = rootNode->Item;
-        libmin_free(rootNode);
+        TreeNodeFree(rootNode);
         rootNode = subtree;
     } else {
         rootNode->Left = DeleteLeftMost(deletedNode, rootNode->Left, finished);
@@ -259,18 +259,18 @@ TreeNode *DeleteByElementRecursive(TreeNode *rootNode,
         if(rootNode->Right == NULL) {
             /* rootNode is replaced by the left child; can be null */
             subtree = rootNode->Left;
-            libmin_free(rootNode->Name);
+            TreeFree(rootNode->Name);
             FreeElement(rootNode->Item);
-            libmin_free(rootNode);
+            TreeNodeFree(rootNode);
             rootNode = subtree;
         } else if(rootNode->Right->Left == NULL)  {
             /* rootNode is replaced by Right */
             subtree = rootNode->Right;
             subtree->Balance = rootNode->Balance;
             subtree->Left = rootNode->Left;
-            libmin_free(rootNode->Name);
+            TreeFree(rootNode->Name);
             FreeElement(rootNode->Item);
-            libmin_free(rootNode);
+            TreeNodeFree(rootNode);
             rootNode = subtree;
         } else {
             /* rootNode is replaced by inorder successor */
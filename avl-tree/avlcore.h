@@ -4,6 +4,7 @@
 
 #include "element.h"
 
+
 /* the basic tree structure
  * the root of the complete tree is defined where Parent is NULL
  */
@@ -15,6 +16,29 @@ typedef struct TreeNodeTag	{
 	short Balance;
 } TreeNode;
 
+/* tree storage allocators, all tree storage is allocated from an arena
+ * (and released at once) when built with ALLOC_ARENA, and TreeNodes are
+ * allocated from an object pool when built with ALLOC_POOL
+ */
+#if defined(ALLOC_ARENA)
+extern libmin_arena_t TreeArena;
+#define TreeAlloc(SZ)	libmin_arena_alloc(&TreeArena, (SZ))
+#define TreeFree(P)
+#define TreeNodeAlloc()	TreeAlloc(sizeof(TreeNode))
+#define TreeNodeFree(P)	TreeFree(P)
+#elif defined(ALLOC_POOL)
+extern libmin_pool_t TreeNodePool;
+#define TreeAlloc(SZ)	libmin_malloc(SZ)
+#define TreeFree(P)	libmin_free(P)
+#define TreeNodeAlloc()	libmin_pool_alloc(&TreeNodePool)
+#define TreeNodeFree(P)	libmin_pool_free(&TreeNodePool, (P))
+#else /* !ALLOC_ARENA && !ALLOC_POOL */
+#define TreeAlloc(SZ)	libmin_malloc(SZ)
+#define TreeFree(P)	libmin_free(P)
+#define TreeNodeAlloc()	TreeAlloc(sizeof(TreeNode))
+#define TreeNodeFree(P)	TreeFree(P)
+#endif
+
 /*
  * This function will find a particular TreeNode with the given
  * Element as the Item.
@@ -1,5 +1,6 @@
 #include "libmin.h"
 #include "element.h"
+#include "avlcore.h"
 
 short Compare(Element Data1, Element Data2)
 {
@@ -12,5 +13,5 @@ short Compare(Element Data1, Element Data2)
 
 void FreeElement(Element Data)
 {
-    libmin_free(Data);
+    TreeFree(Data);
 }
@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+// bubble sort of 400 pseudo-random integers, checks the result is sorted
+// and a permutation of the input, repeated <reps> times where <reps> is the
+// optional first argument
+
+int seed;
+
+int str2int(char *s) {
+    int n;
+    n = 0;
+    while (*s >= '0' && *s <= '9') {
+        n = n * 10 + (*s++ - '0');
+    }
+    return n;
+}
+
+int rand16() {
+    seed = (seed * 1103515245 + 12345) & 2147483647;
+    return (seed >> 8) & 65535;
+}
+
+void bubble_sort(int *a, int n) {
+    int i, j, t, swapped;
+    i = n - 1;
+    swapped = 1;
+    while (i > 0 && swapped) {
+        swapped = 0;
+        j = 0;
+        while (j < i) {
+            if (a[j] > a[j + 1]) {
+                t = a[j];
+                a[j] = a[j + 1];
+                a[j + 1] = t;
+                swapped = 1;
+            }
+            j++;
+        }
+        i--;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int reps, n, i, sum, xor, sorted;
+    int *a;
+
+    reps = 1;
+    if (argc > 1) {
+        reps = str2int(argv[1]);
+    }
+
+    n = 400;
+    a = malloc(n * sizeof(int));
+    while (reps > 0) {
+        seed = 42;
+        sum = 0;
+        xor = 0;
+        i = 0;
+        while (i < n) {
+            a[i] = rand16();
+            sum = sum + a[i];
+            xor = xor ^ a[i];
+            i++;
+        }
+        bubble_sort(a, n);
+        reps--;
+    }
+
+    sorted = 1;
+    i = 0;
+    while (i < n) {
+        if (i > 0 && a[i - 1] > a[i]) {
+            sorted = 0;
+        }
+        sum = sum - a[i];
+        xor = xor ^ a[i];
+        i++;
+    }
+    printf("min %d, median %d, max %d\n", a[0], a[n / 2], a[n - 1]);
+
+    if (!sorted || sum != 0 || xor != 0) {
+        printf("bsort: FAILED\n");
+        return 1;
+    }
+    printf("bsort: PASSED\n");
+    return 0;
+}
@@ -8,7 +8,67 @@ MFILE hello =
   __hello,
   0
 };
-MFILE *mhello = &hello;
+
+// interpreted program, select with PROGRAM=<name> in the Makefile:
+//   hello   - recursive fibonacci table (default)
+//   sieve   - sieve of Eratosthenes
+//   fib     - doubly recursive fibonacci
+//   bsort   - bubble sort
+//   matmult - integer matrix multiply
+//   xc      - the interpreter source xc.c, which compiles and runs hello.c
+// sieve, fib, bsort and matmult repeat their kernel PROGRAM_REPS times, xc
+// nests PROGRAM_REPS levels of xc.c interpreting xc.c (set with REPS=<n>)
+#if defined(PROGRAM_sieve)
+#include "sieve-c.h"
+MFILE program_file = { "sieve.c", __sieve_sz, __sieve, 0 };
+#elif defined(PROGRAM_fib)
+#include "fib-c.h"
+MFILE program_file = { "fib.c", __fib_sz, __fib, 0 };
+#elif defined(PROGRAM_bsort)
+#include "bsort-c.h"
+MFILE program_file = { "bsort.c", __bsort_sz, __bsort, 0 };
+#elif defined(PROGRAM_matmult)
+#include "matmult-c.h"
+MFILE program_file = { "matmult.c", __matmult_sz, __matmult, 0 };
+#elif defined(PROGRAM_xc)
+#include "xc-c.h"
+MFILE program_file = { "xc.c", __xc_sz, __xc, 0 };
+#endif
+
+#ifndef PROGRAM_REPS
+#define PROGRAM_REPS 1
+#endif
+#define __STR(X) #X
+#define STR(X) __STR(X)
+
+#if defined(PROGRAM_sieve) || defined(PROGRAM_fib) || defined(PROGRAM_bsort) || defined(PROGRAM_matmult) || defined(PROGRAM_xc)
+MFILE *mprogram = &program_file;
+
+// files the interpreted program can open()
+MFILE *vm_files[] = { &program_file, &hello };
+#else
+MFILE *mprogram = &hello;
+MFILE *vm_files[] = { &hello };
+#endif
+#define VM_NFILES ((long)(sizeof(vm_files) / sizeof(vm_files[0])))
+
+// VM dispatch engine, select at build time with -DDISPATCH=<engine>:
+//   DISPATCH_IFCHAIN  - if/else-if chain on the opcode (default)
+//   DISPATCH_SWITCH   - switch on the opcode, compiled to a jump table
+//   DISPATCH_THREADED - direct threading, the bytecode is pre-translated
+//                       to handler addresses (needs GCC/clang computed goto)
+#define DISPATCH_IFCHAIN  0
+#define DISPATCH_SWITCH   1
+#define DISPATCH_THREADED 2
+#ifndef DISPATCH
+#define DISPATCH DISPATCH_IFCHAIN
+#endif
+// define VM_STATS to print the number of executed VM instructions, and VM
+// stack/memory loads and stores, at exit
+// define PEEPHOLE to fuse common instruction sequences into superinstructions
+// define REGVM to compile binary operators with a constant or local variable
+// right operand to register-form instructions, and to cache the VM registers
+// in locals of eval()
 
 long debug;    // print the executed instructions
 long assembly; // print out the assembly and source
@@ -18,7 +78,14 @@ long token; // current token
 // instructions
 enum { LEA ,IMM ,JMP ,CALL,JZ  ,JNZ ,ENT ,ADJ ,LEV ,LI  ,LC  ,SI  ,SC  ,PUSH,
        OR  ,XOR ,AND ,EQ  ,NE  ,LT  ,GT  ,LE  ,GE  ,SHL ,SHR ,ADD ,SUB ,MUL ,DIV ,MOD ,
-       OPEN,READ,CLOS,PRTF,MALC,MSET,MCMP,EXIT };
+       OPEN,READ,CLOS,PRTF,MALC,MSET,MCMP,EXIT,
+       // superinstructions, only generated by the peephole pass
+       LLI ,LLC ,PSHI,ADDI,SUBI,MULI,EQJZ,NEJZ,LTJZ,GTJZ,LEJZ,GEJZ,
+       // register-form binary operators, ax = ax op <constant> / <local>, only
+       // generated in REGVM mode, in the same order as OR .. MOD
+       ORC ,XORC,ANDC,EQC ,NEC ,LTC ,GTC ,LEC ,GEC ,SHLC,SHRC,ADDC,SUBC,MULC,DIVC,MODC,
+       ORL ,XORL,ANDL,EQL ,NEL ,LTL ,GTL ,LEL ,GEL ,SHLL,SHRL,ADDL,SUBL,MULL,DIVL,MODL,
+       NOPS };
 
 // tokens and classes (operators last and in precedence order)
 // copied from c4
@@ -51,9 +118,15 @@ long *pc, *bp, *sp, ax, cycle; // virtual machine registers
 
 long *current_id, // current parsed ID
     *symbols,    // symbol table
+    *sym_end,    // next free symbol table entry
     line,        // line number of source code
     token_val;   // value of current token (mainly for number)
 
+// hash index into the symbol table, open addressing with linear probing,
+// must have more slots than the symbol table (poolsize / IdSize) has entries
+#define SYM_SLOTS 8192
+long **sym_index;
+
 long basetype;    // the type of a declaration, make it global for convenience
 long expr_type;   // the type of an expression
 
@@ -71,6 +144,7 @@ long index_of_bp; // index of bp pointer on stack
 void next() {
     char *last_pos;
     long hash;
+    unsigned long slot;
 
     while ((token = *src) != 0) {
         ++src;
@@ -111,19 +185,22 @@ void next() {
                 src++;
             }
 
-            // look for existing identifier, linear search
-            current_id = symbols;
-            while (current_id[Token]) {
+            // look for existing identifier in the hash index
+            slot = (unsigned long)hash & (SYM_SLOTS - 1);
+            while ((current_id = sym_index[slot])) {
                 if (current_id[Hash] == hash && !libmin_memcmp((char *)current_id[Name], last_pos, src - last_pos)) {
                     //found one, return
                     token = current_id[Token];
                     return;
                 }
-                current_id = current_id + IdSize;
+                slot = (slot + 1) & (SYM_SLOTS - 1);
             }
 
 
-            // store new ID
+            // store new ID, and index it in the empty slot
+            current_id = sym_end;
+            sym_end = sym_end + IdSize;
+            sym_index[slot] = current_id;
             current_id[Name] = (long)last_pos;
             current_id[Hash] = hash;
             token = current_id[Token] = Id;
@@ -319,6 +396,30 @@ void match(long tk) {
 }
 
 
+// emit binary operator op, the left operand was pushed by the PUSH at lhs
+// and the right operand is in ax. In REGVM mode, a right operand that is a
+// constant (IMM c) or a local variable (LEA n; LI) is folded into a
+// register-form instruction in place of the PUSH, so the left operand stays
+// in ax. No jump can target code of such a simple operand, so it is safe to
+// rewrite.
+void emit_binop(long *lhs, long op) {
+#ifdef REGVM
+    if (text == lhs + 2 && lhs[1] == IMM) {
+        *lhs = ORC + (op - OR);
+        lhs[1] = lhs[2];
+        text = lhs + 1;
+        return;
+    }
+    if (text == lhs + 3 && lhs[1] == LEA && lhs[3] == LI) {
+        *lhs = ORL + (op - OR);
+        lhs[1] = lhs[2];
+        text = lhs + 1;
+        return;
+    }
+#endif
+    *++text = op;
+}
+
 void expression(long level) {
     // expressions have various format.
     // but majorly can be divided into two parts: unit and operator
@@ -337,6 +438,7 @@ void expression(long level) {
     long *id;
     long tmp;
     long *addr;
+    long *lhs; // PUSH of the left operand of a binary operator
     {
         if (!token) {
             libmin_printf("%ld: unexpected token EOF of expression\n", line);
@@ -569,8 +671,9 @@ void expression(long level) {
                 *++text = IMM;
                 *++text = -1;
                 *++text = PUSH;
+                lhs = text;
                 expression(Inc);
-                *++text = MUL;
+                emit_binop(lhs, MUL);
             }
 
             expr_type = INT;
@@ -660,94 +763,106 @@ void expression(long level) {
                 // bitwise or
                 match(Or);
                 *++text = PUSH;
+                lhs = text;
                 expression(Xor);
-                *++text = OR;
+                emit_binop(lhs, OR);
                 expr_type = INT;
             }
             else if (token == Xor) {
                 // bitwise xor
                 match(Xor);
                 *++text = PUSH;
+                lhs = text;
                 expression(And);
-                *++text = XOR;
+                emit_binop(lhs, XOR);
                 expr_type = INT;
             }
             else if (token == And) {
                 // bitwise and
                 match(And);
                 *++text = PUSH;
+                lhs = text;
                 expression(Eq);
-                *++text = AND;
+                emit_binop(lhs, AND);
                 expr_type = INT;
             }
             else if (token == Eq) {
                 // equal ==
                 match(Eq);
                 *++text = PUSH;
+                lhs = text;
                 expression(Ne);
-                *++text = EQ;
+                emit_binop(lhs, EQ);
                 expr_type = INT;
             }
             else if (token == Ne) {
                 // not equal !=
                 match(Ne);
                 *++text = PUSH;
+                lhs = text;
                 expression(Lt);
-                *++text = NE;
+                emit_binop(lhs, NE);
                 expr_type = INT;
             }
             else if (token == Lt) {
                 // less than
                 match(Lt);
                 *++text = PUSH;
+                lhs = text;
                 expression(Shl);
-                *++text = LT;
+                emit_binop(lhs, LT);
                 expr_type = INT;
             }
             else if (token == Gt) {
                 // greater than
                 match(Gt);
                 *++text = PUSH;
+                lhs = text;
                 expression(Shl);
-                *++text = GT;
+                emit_binop(lhs, GT);
                 expr_type = INT;
             }
             else if (token == Le) {
                 // less than or equal to
                 match(Le);
                 *++text = PUSH;
+                lhs = text;
                 expression(Shl);
-                *++text = LE;
+                emit_binop(lhs, LE);
                 expr_type = INT;
             }
             else if (token == Ge) {
                 // greater than or equal to
                 match(Ge);
                 *++text = PUSH;
+                lhs = text;
                 expression(Shl);
-                *++text = GE;
+                emit_binop(lhs, GE);
                 expr_type = INT;
             }
             else if (token == Shl) {
                 // shift left
                 match(Shl);
                 *++text = PUSH;
+                lhs = text;
                 expression(Add);
-                *++text = SHL;
+                emit_binop(lhs, SHL);
                 expr_type = INT;
             }
             else if (token == Shr) {
                 // shift right
                 match(Shr);
                 *++text = PUSH;
+                lhs = text;
                 expression(Add);
-                *++text = SHR;
+                emit_binop(lhs, SHR);
                 expr_type = INT;
             }
             else if (token == Add) {
                 // add
                 match(Add);
                 *++text = PUSH;
+                lhs = text;
                 expression(Mul);
 
                 expr_type = tmp;
@@ -758,16 +873,17 @@ void expression(long level) {
                     *++text = sizeof(long);
                     *++text = MUL;
                 }
-                *++text = ADD;
+                emit_binop(lhs, ADD);
             }
             else if (token == Sub) {
                 // sub
                 match(Sub);
                 *++text = PUSH;
+                lhs = text;
                 expression(Mul);
                 if (tmp > PTR && tmp == expr_type) {
                     // pointer subtraction
-                    *++text = SUB;
+                    emit_binop(lhs, SUB);
                     *++text = PUSH;
                     *++text = IMM;
                     *++text = sizeof(long);
@@ -779,11 +895,11 @@ void expression(long level) {
                     *++text = IMM;
                     *++text = sizeof(long);
                     *++text = MUL;
-                    *++text = SUB;
+                    emit_binop(lhs, SUB);
                     expr_type = tmp;
                 } else {
                     // numeral subtraction
-                    *++text = SUB;
+                    emit_binop(lhs, SUB);
                     expr_type = tmp;
                 }
             }
@@ -791,24 +907,27 @@ void expression(long level) {
                 // multiply
                 match(Mul);
                 *++text = PUSH;
+                lhs = text;
                 expression(Inc);
-                *++text = MUL;
+                emit_binop(lhs, MUL);
                 expr_type = tmp;
             }
             else if (token == Div) {
                 // divide
                 match(Div);
                 *++text = PUSH;
+                lhs = text;
                 expression(Inc);
-                *++text = DIV;
+                emit_binop(lhs, DIV);
                 expr_type = tmp;
             }
             else if (token == Mod) {
                 // Modulo
                 match(Mod);
                 *++text = PUSH;
+                lhs = text;
                 expression(Inc);
-                *++text = MOD;
+                emit_binop(lhs, MOD);
                 expr_type = tmp;
             }
             else if (token == Inc || token == Dec) {
@@ -843,6 +962,7 @@ void expression(long level) {
                 // array access var[xx]
                 match(Brak);
                 *++text = PUSH;
+                lhs = text;
                 expression(Assign);
                 match(']');
 
@@ -858,7 +978,7 @@ void expression(long level) {
                     libmin_fail(-1);
                 }
                 expr_type = tmp - PTR;
-                *++text = ADD;
+                emit_binop(lhs, ADD);
                 *++text = (expr_type == CHAR) ? LC : LI;
             }
             else {
@@ -1216,20 +1336,90 @@ void program() {
     }
 }
 
-long eval() {
+// open(name, mode) system call, in-memory files only, returns a file
+// descriptor that indexes vm_files[], or -1 if the file does not exist
+long vm_open(char *name, long mode) {
+    long fd;
+    for (fd = 0; fd < VM_NFILES; fd++) {
+        if (!libmin_strcmp(name, vm_files[fd]->fname)) {
+            libmin_mopen(vm_files[fd], "r");
+            return fd;
+        }
+    }
+    return -1;
+}
+
+// length in words of the instruction with opcode op, a superinstruction
+// counts only the length of the instruction it replaced
+long op_len(long op) {
+    return (op <= ADJ || op == LLI || op == LLC || op == PSHI || op >= ORC) ? 2 : 1;
+}
+
+#ifdef PEEPHOLE
+// fuse common instruction sequences in [start, end) into superinstructions.
+// Only the first opcode of a sequence is rewritten, the rest of the sequence
+// stays in place and is skipped by the superinstruction, so no code moves
+// and jumps into the middle of a sequence still execute the original code.
+void peephole(long *start, long *end) {
+    long *p;
+
+    for (p = start; p < end; p = p + op_len(*p)) {
+        if (*p == LEA && p + 2 < end && (p[2] == LI || p[2] == LC)) {
+            *p = p[2] == LI ? LLI : LLC;
+        }
+        else if (*p == IMM && p + 2 < end && p[2] == PUSH) {
+            *p = PSHI;
+        }
+        else if (*p == PUSH && p + 3 < end && p[1] == IMM && (p[3] == ADD || p[3] == SUB || p[3] == MUL)) {
+            *p = p[3] == ADD ? ADDI : p[3] == SUB ? SUBI : MULI;
+        }
+        else if (*p >= EQ && *p <= GE && p + 1 < end && p[1] == JZ) {
+            *p = EQJZ + (*p - EQ);
+        }
+    }
+}
+#endif
+
+#ifdef VM_STATS
+long op_count[NOPS]; // executed instructions, by opcode
+#define VM_COUNT(OP) op_count[OP]++
+#else
+#define VM_COUNT(OP)
+#endif
+
+#ifdef REGVM
+// With REGVM, eval() runs the engine on copies of the VM registers, passed
+// as parameters that shadow the globals so they can live in host registers,
+// and the engine writes them back to the globals on every exit.
+void vm_writeback(long *r_pc, long *r_sp, long *r_bp, long r_ax, long r_cycle) {
+    pc = r_pc; sp = r_sp; bp = r_bp; ax = r_ax; cycle = r_cycle;
+}
+#define VM_WRITEBACK vm_writeback(pc, sp, bp, ax, cycle)
+#define VM_ENGINE    long vm_engine(long *pc, long *sp, long *bp, long ax, long cycle)
+#else
+#define VM_WRITEBACK
+#define VM_ENGINE    long eval()
+#endif
+
+#if DISPATCH == DISPATCH_IFCHAIN
+VM_ENGINE {
     long op, *tmp;
     cycle = 0;
     while (1) {
         cycle ++;
         op = *pc++; // get next operation code
+        VM_COUNT(op);
 
         // print debug info
         if (debug) {
             libmin_printf("%ld> %.4s", cycle,
                    & "LEA ,IMM ,JMP ,CALL,JZ  ,JNZ ,ENT ,ADJ ,LEV ,LI  ,LC  ,SI  ,SC  ,PUSH,"
                    "OR  ,XOR ,AND ,EQ  ,NE  ,LT  ,GT  ,LE  ,GE  ,SHL ,SHR ,ADD ,SUB ,MUL ,DIV ,MOD ,"
-                   "OPEN,READ,CLOS,PRTF,MALC,MSET,MCMP,EXIT"[op * 5]);
-            if (op <= ADJ)
+                   "OPEN,READ,CLOS,PRTF,MALC,MSET,MCMP,EXIT,"
+                   "LLI ,LLC ,PSHI,ADDI,SUBI,MULI,EQJZ,NEJZ,LTJZ,GTJZ,LEJZ,GEJZ,"
+                   "ORC ,XORC,ANDC,EQC ,NEC ,LTC ,GTC ,LEC ,GEC ,SHLC,SHRC,ADDC,SUBC,MULC,DIVC,MODC,"
+                   "ORL ,XORL,ANDL,EQL ,NEL ,LTL ,GTL ,LEL ,GEL ,SHLL,SHRL,ADDL,SUBL,MULL,DIVL,MODL"[op * 5]);
+            if (op_len(op) == 2)
                 libmin_printf(" %ld\n", *pc);
             else
                 libmin_printf("\n");
@@ -1267,20 +1457,253 @@ long eval() {
         else if (op == DIV) ax = *sp++ / ax;
         else if (op == MOD) ax = *sp++ % ax;
 
-        else if (op == EXIT) { libmin_printf("exit(%ld)", *sp); return *sp;}
-        // else if (op == OPEN) { ax = open((char *)sp[1], sp[0]); }
-        // else if (op == CLOS) { ax = close(*sp);}
-        // else if (op == READ) { ax = read(sp[2], (char *)sp[1], *sp); }
+        else if (op == EXIT) { libmin_printf("exit(%ld)", *sp); VM_WRITEBACK; return *sp;}
+        else if (op == OPEN) { ax = vm_open((char *)sp[1], sp[0]); }
+        else if (op == CLOS) { libmin_mclose(vm_files[*sp]); ax = 0;}
+        else if (op == READ) { ax = libmin_mread((char *)sp[1], *sp, vm_files[sp[2]]); }
         else if (op == PRTF) { tmp = sp + pc[1]; ax = libmin_printf((char *)tmp[-1], tmp[-2], tmp[-3], tmp[-4], tmp[-5], tmp[-6]); }
-        // else if (op == MALC) { ax = (long)malloc(*sp);}
+        else if (op == MALC) { ax = (long)libmin_malloc(*sp);}
         else if (op == MSET) { ax = (long)libmin_memset((char *)sp[2], sp[1], *sp);}
         else if (op == MCMP) { ax = libmin_memcmp((char *)sp[2], (char *)sp[1], *sp);}
+
+        // superinstructions, the original tail instructions are skipped
+        else if (op == LLI)  {ax = *(long *)(bp + *pc); pc = pc + 2;}           // LEA n; LI
+        else if (op == LLC)  {ax = *(char *)(bp + *pc); pc = pc + 2;}           // LEA n; LC
+        else if (op == PSHI) {ax = *pc; *--sp = ax; pc = pc + 2;}               // IMM x; PUSH
+        else if (op == ADDI) {ax = ax + pc[1]; pc = pc + 3;}                    // PUSH; IMM x; ADD
+        else if (op == SUBI) {ax = ax - pc[1]; pc = pc + 3;}                    // PUSH; IMM x; SUB
+        else if (op == MULI) {ax = ax * pc[1]; pc = pc + 3;}                    // PUSH; IMM x; MUL
+        else if (op == EQJZ) {ax = *sp++ == ax; pc = ax ? pc + 2 : (long *)pc[1];} // EQ; JZ addr
+        else if (op == NEJZ) {ax = *sp++ != ax; pc = ax ? pc + 2 : (long *)pc[1];} // NE; JZ addr
+        else if (op == LTJZ) {ax = *sp++ <  ax; pc = ax ? pc + 2 : (long *)pc[1];} // LT; JZ addr
+        else if (op == GTJZ) {ax = *sp++ >  ax; pc = ax ? pc + 2 : (long *)pc[1];} // GT; JZ addr
+        else if (op == LEJZ) {ax = *sp++ <= ax; pc = ax ? pc + 2 : (long *)pc[1];} // LE; JZ addr
+        else if (op == GEJZ) {ax = *sp++ >= ax; pc = ax ? pc + 2 : (long *)pc[1];} // GE; JZ addr
+
+        // register-form binary operators
+        else if (op == ORC)  {ax = ax | *pc++;}
+        else if (op == XORC) {ax = ax ^ *pc++;}
+        else if (op == ANDC) {ax = ax & *pc++;}
+        else if (op == EQC)  {ax = ax == *pc++;}
+        else if (op == NEC)  {ax = ax != *pc++;}
+        else if (op == LTC)  {ax = ax < *pc++;}
+        else if (op == GTC)  {ax = ax > *pc++;}
+        else if (op == LEC)  {ax = ax <= *pc++;}
+        else if (op == GEC)  {ax = ax >= *pc++;}
+        else if (op == SHLC) {ax = ax << *pc++;}
+        else if (op == SHRC) {ax = ax >> *pc++;}
+        else if (op == ADDC) {ax = ax + *pc++;}
+        else if (op == SUBC) {ax = ax - *pc++;}
+        else if (op == MULC) {ax = ax * *pc++;}
+        else if (op == DIVC) {ax = ax / *pc++;}
+        else if (op == MODC) {ax = ax % *pc++;}
+        else if (op == ORL)  {ax = ax | bp[*pc++];}
+        else if (op == XORL) {ax = ax ^ bp[*pc++];}
+        else if (op == ANDL) {ax = ax & bp[*pc++];}
+        else if (op == EQL)  {ax = ax == bp[*pc++];}
+        else if (op == NEL)  {ax = ax != bp[*pc++];}
+        else if (op == LTL)  {ax = ax < bp[*pc++];}
+        else if (op == GTL)  {ax = ax > bp[*pc++];}
+        else if (op == LEL)  {ax = ax <= bp[*pc++];}
+        else if (op == GEL)  {ax = ax >= bp[*pc++];}
+        else if (op == SHLL) {ax = ax << bp[*pc++];}
+        else if (op == SHRL) {ax = ax >> bp[*pc++];}
+        else if (op == ADDL) {ax = ax + bp[*pc++];}
+        else if (op == SUBL) {ax = ax - bp[*pc++];}
+        else if (op == MULL) {ax = ax * bp[*pc++];}
+        else if (op == DIVL) {ax = ax / bp[*pc++];}
+        else if (op == MODL) {ax = ax % bp[*pc++];}
         else {
             libmin_printf("unknown instruction:%ld\n", op);
+            VM_WRITEBACK;
             return -1;
         }
     }
 }
+#elif DISPATCH == DISPATCH_SWITCH || DISPATCH == DISPATCH_THREADED
+
+#if DISPATCH == DISPATCH_THREADED
+// translate the opcodes in [start, end) to handler addresses, in place
+void thread_code(long *start, long *end, void **handlers) {
+    while (start < end) {
+        long op = *start;
+        *start++ = (long)handlers[op];
+        if (op_len(op) == 2) {
+            start++; // skip the operand
+        }
+    }
+}
+
+#define VM_CASE(OP) L_##OP: VM_COUNT(OP);
+#define VM_NEXT     do { cycle++; goto *(void *)*pc++; } while (0)
+#else /* DISPATCH_SWITCH */
+#define VM_CASE(OP) case OP: VM_COUNT(OP);
+#define VM_NEXT     continue
+#endif
+
+VM_ENGINE {
+    long *tmp;
+    cycle = 0;
+
+#if DISPATCH == DISPATCH_THREADED
+    // handler addresses, in opcode order
+    static void *handlers[] = {
+        &&L_LEA , &&L_IMM , &&L_JMP , &&L_CALL, &&L_JZ  , &&L_JNZ , &&L_ENT , &&L_ADJ , &&L_LEV , &&L_LI  , &&L_LC  , &&L_SI  , &&L_SC  , &&L_PUSH,
+        &&L_OR  , &&L_XOR , &&L_AND , &&L_EQ  , &&L_NE  , &&L_LT  , &&L_GT  , &&L_LE  , &&L_GE  , &&L_SHL , &&L_SHR , &&L_ADD , &&L_SUB , &&L_MUL , &&L_DIV , &&L_MOD ,
+        &&L_OPEN, &&L_READ, &&L_CLOS, &&L_PRTF, &&L_MALC, &&L_MSET, &&L_MCMP, &&L_EXIT,
+        &&L_LLI , &&L_LLC , &&L_PSHI, &&L_ADDI, &&L_SUBI, &&L_MULI, &&L_EQJZ, &&L_NEJZ, &&L_LTJZ, &&L_GTJZ, &&L_LEJZ, &&L_GEJZ,
+        &&L_ORC , &&L_XORC, &&L_ANDC, &&L_EQC , &&L_NEC , &&L_LTC , &&L_GTC , &&L_LEC , &&L_GEC , &&L_SHLC, &&L_SHRC, &&L_ADDC, &&L_SUBC, &&L_MULC, &&L_DIVC, &&L_MODC,
+        &&L_ORL , &&L_XORL, &&L_ANDL, &&L_EQL , &&L_NEL , &&L_LTL , &&L_GTL , &&L_LEL , &&L_GEL , &&L_SHLL, &&L_SHRL, &&L_ADDL, &&L_SUBL, &&L_MULL, &&L_DIVL, &&L_MODL };
+
+    // translate the text segment, and the exit stub main() left on the stack
+    thread_code(old_text + 1, text + 1, handlers);
+    tmp = (long *)((long)stack + poolsize);
+    thread_code(tmp - 2, tmp, handlers);
+
+    VM_NEXT;
+#else /* DISPATCH_SWITCH */
+    while (1) {
+        cycle ++;
+        switch (*pc++) {
+#endif
+        VM_CASE(IMM)  ax = *pc++; VM_NEXT;                                     // load immediate value to ax
+        VM_CASE(LC)   ax = *(char *)ax; VM_NEXT;                               // load character to ax, address in ax
+        VM_CASE(LI)   ax = *(long *)ax; VM_NEXT;                               // load integer to ax, address in ax
+        VM_CASE(SC)   ax = *(char *)*sp++ = ax; VM_NEXT;                       // save character to address, value in ax, address on stack
+        VM_CASE(SI)   *(long *)*sp++ = ax; VM_NEXT;                            // save integer to address, value in ax, address on stack
+        VM_CASE(PUSH) *--sp = ax; VM_NEXT;                                     // push the value of ax onto the stack
+        VM_CASE(JMP)  pc = (long *)*pc; VM_NEXT;                               // jump to the address
+        VM_CASE(JZ)   pc = ax ? pc + 1 : (long *)*pc; VM_NEXT;                 // jump if ax is zero
+        VM_CASE(JNZ)  pc = ax ? (long *)*pc : pc + 1; VM_NEXT;                 // jump if ax is not zero
+        VM_CASE(CALL) *--sp = (long)(pc+1); pc = (long *)*pc; VM_NEXT;         // call subroutine
+        VM_CASE(ENT)  *--sp = (long)bp; bp = sp; sp = sp - *pc++; VM_NEXT;     // make new stack frame
+        VM_CASE(ADJ)  sp = sp + *pc++; VM_NEXT;                                // add esp, <size>
+        VM_CASE(LEV)  sp = bp; bp = (long *)*sp++; pc = (long *)*sp++; VM_NEXT; // restore call frame and PC
+        VM_CASE(LEA)  ax = (long)(bp + *pc++); VM_NEXT;                        // load address for arguments.
+
+        VM_CASE(OR)   ax = *sp++ | ax; VM_NEXT;
+        VM_CASE(XOR)  ax = *sp++ ^ ax; VM_NEXT;
+        VM_CASE(AND)  ax = *sp++ & ax; VM_NEXT;
+        VM_CASE(EQ)   ax = *sp++ == ax; VM_NEXT;
+        VM_CASE(NE)   ax = *sp++ != ax; VM_NEXT;
+        VM_CASE(LT)   ax = *sp++ < ax; VM_NEXT;
+        VM_CASE(LE)   ax = *sp++ <= ax; VM_NEXT;
+        VM_CASE(GT)   ax = *sp++ >  ax; VM_NEXT;
+        VM_CASE(GE)   ax = *sp++ >= ax; VM_NEXT;
+        VM_CASE(SHL)  ax = *sp++ << ax; VM_NEXT;
+        VM_CASE(SHR)  ax = *sp++ >> ax; VM_NEXT;
+        VM_CASE(ADD)  ax = *sp++ + ax; VM_NEXT;
+        VM_CASE(SUB)  ax = *sp++ - ax; VM_NEXT;
+        VM_CASE(MUL)  ax = *sp++ * ax; VM_NEXT;
+        VM_CASE(DIV)  ax = *sp++ / ax; VM_NEXT;
+        VM_CASE(MOD)  ax = *sp++ % ax; VM_NEXT;
+
+        VM_CASE(EXIT) libmin_printf("exit(%ld)", *sp); VM_WRITEBACK; return *sp;
+        VM_CASE(PRTF) tmp = sp + pc[1]; ax = libmin_printf((char *)tmp[-1], tmp[-2], tmp[-3], tmp[-4], tmp[-5], tmp[-6]); VM_NEXT;
+        VM_CASE(OPEN) ax = vm_open((char *)sp[1], sp[0]); VM_NEXT;
+        VM_CASE(CLOS) libmin_mclose(vm_files[*sp]); ax = 0; VM_NEXT;
+        VM_CASE(READ) ax = libmin_mread((char *)sp[1], *sp, vm_files[sp[2]]); VM_NEXT;
+        VM_CASE(MALC) ax = (long)libmin_malloc(*sp); VM_NEXT;
+        VM_CASE(MSET) ax = (long)libmin_memset((char *)sp[2], sp[1], *sp); VM_NEXT;
+        VM_CASE(MCMP) ax = libmin_memcmp((char *)sp[2], (char *)sp[1], *sp); VM_NEXT;
+
+        // superinstructions, the original tail instructions are skipped
+        VM_CASE(LLI)  ax = *(long *)(bp + *pc); pc = pc + 2; VM_NEXT;          // LEA n; LI
+        VM_CASE(LLC)  ax = *(char *)(bp + *pc); pc = pc + 2; VM_NEXT;          // LEA n; LC
+        VM_CASE(PSHI) ax = *pc; *--sp = ax; pc = pc + 2; VM_NEXT;              // IMM x; PUSH
+        VM_CASE(ADDI) ax = ax + pc[1]; pc = pc + 3; VM_NEXT;                   // PUSH; IMM x; ADD
+        VM_CASE(SUBI) ax = ax - pc[1]; pc = pc + 3; VM_NEXT;                   // PUSH; IMM x; SUB
+        VM_CASE(MULI) ax = ax * pc[1]; pc = pc + 3; VM_NEXT;                   // PUSH; IMM x; MUL
+        VM_CASE(EQJZ) ax = *sp++ == ax; pc = ax ? pc + 2 : (long *)pc[1]; VM_NEXT; // EQ; JZ addr
+        VM_CASE(NEJZ) ax = *sp++ != ax; pc = ax ? pc + 2 : (long *)pc[1]; VM_NEXT; // NE; JZ addr
+        VM_CASE(LTJZ) ax = *sp++ <  ax; pc = ax ? pc + 2 : (long *)pc[1]; VM_NEXT; // LT; JZ addr
+        VM_CASE(GTJZ) ax = *sp++ >  ax; pc = ax ? pc + 2 : (long *)pc[1]; VM_NEXT; // GT; JZ addr
+        VM_CASE(LEJZ) ax = *sp++ <= ax; pc = ax ? pc + 2 : (long *)pc[1]; VM_NEXT; // LE; JZ addr
+        VM_CASE(GEJZ) ax = *sp++ >= ax; pc = ax ? pc + 2 : (long *)pc[1]; VM_NEXT; // GE; JZ addr
+
+        // register-form binary operators
+        VM_CASE(ORC)  ax = ax | *pc++; VM_NEXT;
+        VM_CASE(XORC) ax = ax ^ *pc++; VM_NEXT;
+        VM_CASE(ANDC) ax = ax & *pc++; VM_NEXT;
+        VM_CASE(EQC)  ax = ax == *pc++; VM_NEXT;
+        VM_CASE(NEC)  ax = ax != *pc++; VM_NEXT;
+        VM_CASE(LTC)  ax = ax < *pc++; VM_NEXT;
+        VM_CASE(GTC)  ax = ax > *pc++; VM_NEXT;
+        VM_CASE(LEC)  ax = ax <= *pc++; VM_NEXT;
+        VM_CASE(GEC)  ax = ax >= *pc++; VM_NEXT;
+        VM_CASE(SHLC) ax = ax << *pc++; VM_NEXT;
+        VM_CASE(SHRC) ax = ax >> *pc++; VM_NEXT;
+        VM_CASE(ADDC) ax = ax + *pc++; VM_NEXT;
+        VM_CASE(SUBC) ax = ax - *pc++; VM_NEXT;
+        VM_CASE(MULC) ax = ax * *pc++; VM_NEXT;
+        VM_CASE(DIVC) ax = ax / *pc++; VM_NEXT;
+        VM_CASE(MODC) ax = ax % *pc++; VM_NEXT;
+        VM_CASE(ORL)  ax = ax | bp[*pc++]; VM_NEXT;
+        VM_CASE(XORL) ax = ax ^ bp[*pc++]; VM_NEXT;
+        VM_CASE(ANDL) ax = ax & bp[*pc++]; VM_NEXT;
+        VM_CASE(EQL)  ax = ax == bp[*pc++]; VM_NEXT;
+        VM_CASE(NEL)  ax = ax != bp[*pc++]; VM_NEXT;
+        VM_CASE(LTL)  ax = ax < bp[*pc++]; VM_NEXT;
+        VM_CASE(GTL)  ax = ax > bp[*pc++]; VM_NEXT;
+        VM_CASE(LEL)  ax = ax <= bp[*pc++]; VM_NEXT;
+        VM_CASE(GEL)  ax = ax >= bp[*pc++]; VM_NEXT;
+        VM_CASE(SHLL) ax = ax << bp[*pc++]; VM_NEXT;
+        VM_CASE(SHRL) ax = ax >> bp[*pc++]; VM_NEXT;
+        VM_CASE(ADDL) ax = ax + bp[*pc++]; VM_NEXT;
+        VM_CASE(SUBL) ax = ax - bp[*pc++]; VM_NEXT;
+        VM_CASE(MULL) ax = ax * bp[*pc++]; VM_NEXT;
+        VM_CASE(DIVL) ax = ax / bp[*pc++]; VM_NEXT;
+        VM_CASE(MODL) ax = ax % bp[*pc++]; VM_NEXT;
+
+#if DISPATCH == DISPATCH_SWITCH
+        default:
+            libmin_printf("unknown instruction:%ld\n", pc[-1]);
+            VM_WRITEBACK;
+            return -1;
+        }
+    }
+#endif
+}
+
+#else
+#error Unknown DISPATCH engine.
+#endif
+
+#ifdef REGVM
+long eval() {
+    return vm_engine(pc, sp, bp, ax, cycle);
+}
+#endif
+
+#ifdef VM_STATS
+// print the executed instruction count, and the VM stack and memory loads
+// and stores of the executed instructions (excluding library calls)
+void vm_report() {
+    // loads and stores of each instruction, by opcode
+    static char loads[NOPS] = {
+        0,0,0,0,0,0,0,0,2,1,1,1,1,0,                        // LEA .. PUSH
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,                    // OR .. MOD
+        2,3,1,6,1,3,3,1,                                    // OPEN .. EXIT
+        1,1,0,0,0,0,1,1,1,1,1,1,                            // LLI .. GEJZ
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,                    // ORC .. MODC
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 };                  // ORL .. MODL
+    static char stores[NOPS] = {
+        0,0,0,1,0,0,1,0,0,0,0,1,1,1,                        // LEA .. PUSH
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,                    // OR .. MOD
+        0,0,0,0,0,0,0,0,                                    // OPEN .. EXIT
+        0,0,1,0,0,0,0,0,0,0,0,0,                            // LLI .. GEJZ
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,                    // ORC .. MODC
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 };                  // ORL .. MODL
+    long op, nloads = 0, nstores = 0;
+
+    for (op = 0; op < NOPS; op++) {
+        nloads = nloads + op_count[op] * loads[op];
+        nstores = nstores + op_count[op] * stores[op];
+    }
+    libmin_printf("\nVM: %ld instructions executed\n", cycle);
+    libmin_printf("VM: %ld loads, %ld stores\n", nloads, nstores);
+}
+#endif
 
 
 int main(int _argc, char **_argv)
@@ -1289,8 +1712,21 @@ int main(int _argc, char **_argv)
     long i;
     long *tmp;
 
+#if defined(PROGRAM_xc)
+    // c-interp xc.c ... xc.c hello.c, with PROGRAM_REPS copies of xc.c
+    int argc = PROGRAM_REPS + 2;
+    char *myargv[PROGRAM_REPS + 2];
+    myargv[0] = "c-interp";
+    for (i = 1; i <= PROGRAM_REPS; i++)
+        myargv[i] = "xc.c";
+    myargv[argc - 1] = "hello.c";
+#elif defined(PROGRAM_sieve) || defined(PROGRAM_fib) || defined(PROGRAM_bsort) || defined(PROGRAM_matmult)
+    int argc = 3;
+    char *myargv[3] = { "c-interp", NULL, STR(PROGRAM_REPS) };
+#else
     int argc = 2;
-    char *myargv[2] = { "c-interp", "hello.c" };
+    char *myargv[2] = { "c-interp", NULL };
+#endif
     char **argv = myargv;
 
     argc--;
@@ -1314,7 +1750,8 @@ int main(int _argc, char **_argv)
     }
 #endif
 
-    libmin_mopen(mhello, "r");
+    myargv[1] = mprogram->fname;
+    libmin_mopen(mprogram, "r");
 
     poolsize = 256 * 1024; // arbitrary size
     line = 1;
@@ -1336,11 +1773,17 @@ int main(int _argc, char **_argv)
         libmin_printf("could not malloc(%ld) for symbol table\n", poolsize);
         return -1;
     }
+    if (!(sym_index = libmin_malloc(SYM_SLOTS * sizeof(long *)))) {
+        libmin_printf("could not malloc(%ld) for symbol index\n", (long)(SYM_SLOTS * sizeof(long *)));
+        return -1;
+    }
 
     libmin_memset(text, 0, poolsize);
     libmin_memset(data, 0, poolsize);
     libmin_memset(stack, 0, poolsize);
     libmin_memset(symbols, 0, poolsize);
+    libmin_memset(sym_index, 0, SYM_SLOTS * sizeof(long *));
+    sym_end = symbols;
 
     old_text = text;
 
@@ -1371,14 +1814,17 @@ int main(int _argc, char **_argv)
         return -1;
     }
     // read the source file
-    if ((i = libmin_mread(src, poolsize-1, mhello)) <= 0) {
+    if ((i = libmin_mread(src, poolsize-1, mprogram)) <= 0) {
         libmin_printf("read() returned %ld\n", i);
         return -1;
     }
     src[i] = 0; // add EOF character
-    libmin_mclose(mhello);
+    libmin_mclose(mprogram);
 
     program();
+#ifdef PEEPHOLE
+    peephole(old_text + 1, text + 1);
+#endif
 
     if (!(pc = (long *)idmain[Value])) {
         libmin_printf("main() not defined\n");
@@ -1395,11 +1841,17 @@ int main(int _argc, char **_argv)
     sp = (long *)((long)stack + poolsize);
     *--sp = EXIT; // call exit if main returns
     *--sp = PUSH; tmp = sp;
-    *--sp = 1;
+    *--sp = argc;
     *--sp = (long)argv;
     *--sp = (long)tmp;
 
+    libtarg_start_perf();
     (void)eval();
+    libtarg_stop_perf();
+
+#ifdef VM_STATS
+    vm_report();
+#endif
 
     libmin_success();
     return 9;
@@ -0,0 +1,59 @@
+#include <stdio.h>
+
+// doubly recursive Fibonacci, computes fib(0) .. fib(24) and checks them
+// against an iterative computation, repeated <reps> times where <reps> is
+// the optional first argument
+
+int str2int(char *s) {
+    int n;
+    n = 0;
+    while (*s >= '0' && *s <= '9') {
+        n = n * 10 + (*s++ - '0');
+    }
+    return n;
+}
+
+int fib(int n) {
+    if (n < 2) {
+        return n;
+    }
+    return fib(n - 1) + fib(n - 2);
+}
+
+int main(int argc, char **argv)
+{
+    int reps, i, a, b, t, f, errors;
+
+    reps = 1;
+    if (argc > 1) {
+        reps = str2int(argv[1]);
+    }
+
+    errors = 0;
+    while (reps > 0) {
+        i = 0;
+        a = 0;
+        b = 1;
+        while (i <= 24) {
+            f = fib(i);
+            if (f != a) {
+                errors++;
+            }
+            if (reps == 1 && i % 4 == 0) {
+                printf("fib(%d) = %d\n", i, f);
+            }
+            t = a + b;
+            a = b;
+            b = t;
+            i++;
+        }
+        reps--;
+    }
+
+    if (errors != 0 || fib(24) != 46368) {
+        printf("fib: FAILED\n");
+        return 1;
+    }
+    printf("fib: PASSED\n");
+    return 0;
+}
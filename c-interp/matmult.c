@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+// 32x32 integer matrix multiply, C = A * B, checked against the identity
+// sum(C) = sum_k (column sum k of A) * (row sum k of B), repeated <reps>
+// times where <reps> is the optional first argument
+
+int str2int(char *s) {
+    int n;
+    n = 0;
+    while (*s >= '0' && *s <= '9') {
+        n = n * 10 + (*s++ - '0');
+    }
+    return n;
+}
+
+void matmult(int *a, int *b, int *c, int n) {
+    int i, j, k, sum;
+    i = 0;
+    while (i < n) {
+        j = 0;
+        while (j < n) {
+            sum = 0;
+            k = 0;
+            while (k < n) {
+                sum = sum + a[i * n + k] * b[k * n + j];
+                k++;
+            }
+            c[i * n + j] = sum;
+            j++;
+        }
+        i++;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int reps, n, i, j, total, expect, colsum, rowsum;
+    int *a, *b, *c;
+
+    reps = 1;
+    if (argc > 1) {
+        reps = str2int(argv[1]);
+    }
+
+    n = 32;
+    a = malloc(n * n * sizeof(int));
+    b = malloc(n * n * sizeof(int));
+    c = malloc(n * n * sizeof(int));
+    i = 0;
+    while (i < n * n) {
+        a[i] = (i * 7 + 3) % 19 - 9;
+        b[i] = (i * 13 + 5) % 23 - 11;
+        i++;
+    }
+
+    while (reps > 0) {
+        matmult(a, b, c, n);
+        reps--;
+    }
+
+    total = 0;
+    i = 0;
+    while (i < n * n) {
+        total = total + c[i];
+        i++;
+    }
+    expect = 0;
+    i = 0;
+    while (i < n) {
+        colsum = 0;
+        rowsum = 0;
+        j = 0;
+        while (j < n) {
+            colsum = colsum + a[j * n + i];
+            rowsum = rowsum + b[i * n + j];
+            j++;
+        }
+        expect = expect + colsum * rowsum;
+        i++;
+    }
+    printf("c[0][0] %d, c[%d][%d] %d, sum %d\n", c[0], n - 1, n - 1, c[n * n - 1], total);
+
+    if (total != expect) {
+        printf("matmult: FAILED\n");
+        return 1;
+    }
+    printf("matmult: PASSED\n");
+    return 0;
+}
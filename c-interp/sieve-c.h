@@ -0,0 +1,2 @@
+#define __sieve_sz 1412
+const uint8_t __sieve[1412] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x68,0x3e,0xa,0xa,0x2f,0x2f,0x20,0x73,0x69,0x65,0x76,0x65,0x20,0x6f,0x66,0x20,0x45,0x72,0x61,0x74,0x6f,0x73,0x74,0x68,0x65,0x6e,0x65,0x73,0x2c,0x20,0x63,0x6f,0x75,0x6e,0x74,0x73,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x69,0x6d,0x65,0x73,0x20,0x62,0x65,0x6c,0x6f,0x77,0x20,0x33,0x32,0x37,0x36,0x38,0x20,0x28,0x33,0x35,0x31,0x32,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x6d,0x29,0x2c,0xa,0x2f,0x2f,0x20,0x72,0x65,0x70,0x65,0x61,0x74,0x65,0x64,0x20,0x3c,0x72,0x65,0x70,0x73,0x3e,0x20,0x74,0x69,0x6d,0x65,0x73,0x20,0x77,0x68,0x65,0x72,0x65,0x20,0x3c,0x72,0x65,0x70,0x73,0x3e,0x20,0x69,0x73,0x20,0x74,0x68,0x65,0x20,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0xa,0xa,0x69,0x6e,0x74,0x20,0x73,0x74,0x72,0x32,0x69,0x6e,0x74,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x2a,0x73,0x20,0x3e,0x3d,0x20,0x27,0x30,0x27,0x20,0x26,0x26,0x20,0x2a,0x73,0x20,0x3c,0x3d,0x20,0x27,0x39,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x6e,0x20,0x2a,0x20,0x31,0x30,0x20,0x2b,0x20,0x28,0x2a,0x73,0x2b,0x2b,0x20,0x2d,0x20,0x27,0x30,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x3b,0xa,0x7d,0xa,0xa,0x69,0x6e,0x74,0x20,0x73,0x69,0x65,0x76,0x65,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6c,0x61,0x67,0x73,0x2c,0x20,0x69,0x6e,0x74,0x20,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x2c,0x20,0x6a,0x2c,0x20,0x63,0x6f,0x75,0x6e,0x74,0x3b,0xa,0x20,0x20,0x20,0x20,0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,0x66,0x6c,0x61,0x67,0x73,0x2c,0x20,0x31,0x2c,0x20,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x32,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x69,0x20,0x3c,0x20,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x66,0x6c,0x61,0x67,0x73,0x5b,0x69,0x5d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x75,0x6e,0x74,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6a,0x20,0x3d,0x20,0x69,0x20,0x2b,0x20,0x69,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x6a,0x20,0x3c,0x20,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x61,0x67,0x73,0x5b,0x6a,0x5d,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6a,0x20,0x3d,0x20,0x6a,0x20,0x2b,0x20,0x69,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x75,0x6e,0x74,0x3b,0xa,0x7d,0xa,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x69,0x6e,0x74,0x20,0x61,0x72,0x67,0x63,0x2c,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x2a,0x61,0x72,0x67,0x76,0x29,0xa,0x7b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x72,0x65,0x70,0x73,0x2c,0x20,0x6e,0x2c,0x20,0x63,0x6f,0x75,0x6e,0x74,0x2c,0x20,0x73,0x75,0x6d,0x2c,0x20,0x69,0x2c,0x20,0x6b,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x66,0x6c,0x61,0x67,0x73,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x70,0x73,0x20,0x3d,0x20,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x72,0x67,0x63,0x20,0x3e,0x20,0x31,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x70,0x73,0x20,0x3d,0x20,0x73,0x74,0x72,0x32,0x69,0x6e,0x74,0x28,0x61,0x72,0x67,0x76,0x5b,0x31,0x5d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x33,0x32,0x37,0x36,0x38,0x3b,0xa,0x20,0x20,0x20,0x20,0x66,0x6c,0x61,0x67,0x73,0x20,0x3d,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x72,0x65,0x70,0x73,0x20,0x3e,0x20,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,0x73,0x69,0x65,0x76,0x65,0x28,0x66,0x6c,0x61,0x67,0x73,0x2c,0x20,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x70,0x73,0x2d,0x2d,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x72,0x69,0x6e,0x74,0x20,0x61,0x6e,0x64,0x20,0x63,0x68,0x65,0x63,0x6b,0x73,0x75,0x6d,0x20,0x74,0x68,0x65,0x20,0x31,0x30,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x20,0x70,0x72,0x69,0x6d,0x65,0x73,0xa,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x6b,0x20,0x3d,0x20,0x31,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x6e,0x20,0x2d,0x20,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x6b,0x20,0x3e,0x20,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x66,0x6c,0x61,0x67,0x73,0x5b,0x69,0x5d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x20,0x22,0x2c,0x20,0x69,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x73,0x75,0x6d,0x20,0x2b,0x20,0x69,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2d,0x2d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x2d,0x2d,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x5c,0x6e,0x70,0x72,0x69,0x6d,0x65,0x73,0x20,0x62,0x65,0x6c,0x6f,0x77,0x20,0x25,0x64,0x3a,0x20,0x25,0x64,0x2c,0x20,0x63,0x68,0x65,0x63,0x6b,0x73,0x75,0x6d,0x20,0x25,0x64,0x5c,0x6e,0x22,0x2c,0x20,0x6e,0x2c,0x20,0x63,0x6f,0x75,0x6e,0x74,0x2c,0x20,0x73,0x75,0x6d,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x6f,0x75,0x6e,0x74,0x20,0x21,0x3d,0x20,0x33,0x35,0x31,0x32,0x20,0x7c,0x7c,0x20,0x73,0x75,0x6d,0x20,0x21,0x3d,0x20,0x33,0x32,0x36,0x39,0x31,0x38,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x73,0x69,0x65,0x76,0x65,0x3a,0x20,0x46,0x41,0x49,0x4c,0x45,0x44,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x73,0x69,0x65,0x76,0x65,0x3a,0x20,0x50,0x41,0x53,0x53,0x45,0x44,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0xa,0x7d,0xa};
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// sieve of Eratosthenes, counts the primes below 32768 (3512 of them),
+// repeated <reps> times where <reps> is the optional first argument
+
+int str2int(char *s) {
+    int n;
+    n = 0;
+    while (*s >= '0' && *s <= '9') {
+        n = n * 10 + (*s++ - '0');
+    }
+    return n;
+}
+
+int sieve(char *flags, int n) {
+    int i, j, count;
+    memset(flags, 1, n);
+    count = 0;
+    i = 2;
+    while (i < n) {
+        if (flags[i]) {
+            count++;
+            j = i + i;
+            while (j < n) {
+                flags[j] = 0;
+                j = j + i;
+            }
+        }
+        i++;
+    }
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    int reps, n, count, sum, i, k;
+    char *flags;
+
+    reps = 1;
+    if (argc > 1) {
+        reps = str2int(argv[1]);
+    }
+
+    n = 32768;
+    flags = malloc(n);
+    while (reps > 0) {
+        count = sieve(flags, n);
+        reps--;
+    }
+
+    // print and checksum the 10 largest primes
+    sum = 0;
+    k = 10;
+    i = n - 1;
+    while (k > 0) {
+        if (flags[i]) {
+            printf("%d ", i);
+            sum = sum + i;
+            k--;
+        }
+        i--;
+    }
+    printf("\nprimes below %d: %d, checksum %d\n", n, count, sum);
+
+    if (count != 3512 || sum != 326918) {
+        printf("sieve: FAILED\n");
+        return 1;
+    }
+    printf("sieve: PASSED\n");
+    return 0;
+}
@@ -0,0 +1,2 @@
+#define __xc_sz 40744
+const uint8_t __xc[40744] = {0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x69,0x6f,0x2e,0x68,0x3e,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x64,0x6c,0x69,0x62,0x2e,0x68,0x3e,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x2e,0x68,0x3e,0xa,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x68,0x3e,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x77,0x6f,0x72,0x6b,0x20,0x77,0x69,0x74,0x68,0x20,0x36,0x34,0x62,0x69,0x74,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0xa,0xa,0x69,0x6e,0x74,0x20,0x64,0x65,0x62,0x75,0x67,0x3b,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x72,0x69,0x6e,0x74,0x20,0x74,0x68,0x65,0x20,0x65,0x78,0x65,0x63,0x75,0x74,0x65,0x64,0x20,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x73,0xa,0x69,0x6e,0x74,0x20,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x79,0x3b,0x20,0x2f,0x2f,0x20,0x70,0x72,0x69,0x6e,0x74,0x20,0x6f,0x75,0x74,0x20,0x74,0x68,0x65,0x20,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x79,0x20,0x61,0x6e,0x64,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0xa,0xa,0x69,0x6e,0x74,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x3b,0x20,0x2f,0x2f,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x74,0x6f,0x6b,0x65,0x6e,0xa,0xa,0x2f,0x2f,0x20,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x73,0xa,0x65,0x6e,0x75,0x6d,0x20,0x7b,0x20,0x4c,0x45,0x41,0x20,0x2c,0x49,0x4d,0x4d,0x20,0x2c,0x4a,0x4d,0x50,0x20,0x2c,0x43,0x41,0x4c,0x4c,0x2c,0x4a,0x5a,0x20,0x20,0x2c,0x4a,0x4e,0x5a,0x20,0x2c,0x45,0x4e,0x54,0x20,0x2c,0x41,0x44,0x4a,0x20,0x2c,0x4c,0x45,0x56,0x20,0x2c,0x4c,0x49,0x20,0x20,0x2c,0x4c,0x43,0x20,0x20,0x2c,0x53,0x49,0x20,0x20,0x2c,0x53,0x43,0x20,0x20,0x2c,0x50,0x55,0x53,0x48,0x2c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4f,0x52,0x20,0x20,0x2c,0x58,0x4f,0x52,0x20,0x2c,0x41,0x4e,0x44,0x20,0x2c,0x45,0x51,0x20,0x20,0x2c,0x4e,0x45,0x20,0x20,0x2c,0x4c,0x54,0x20,0x20,0x2c,0x47,0x54,0x20,0x20,0x2c,0x4c,0x45,0x20,0x20,0x2c,0x47,0x45,0x20,0x20,0x2c,0x53,0x48,0x4c,0x20,0x2c,0x53,0x48,0x52,0x20,0x2c,0x41,0x44,0x44,0x20,0x2c,0x53,0x55,0x42,0x20,0x2c,0x4d,0x55,0x4c,0x20,0x2c,0x44,0x49,0x56,0x20,0x2c,0x4d,0x4f,0x44,0x20,0x2c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4f,0x50,0x45,0x4e,0x2c,0x52,0x45,0x41,0x44,0x2c,0x43,0x4c,0x4f,0x53,0x2c,0x50,0x52,0x54,0x46,0x2c,0x4d,0x41,0x4c,0x43,0x2c,0x4d,0x53,0x45,0x54,0x2c,0x4d,0x43,0x4d,0x50,0x2c,0x45,0x58,0x49,0x54,0x20,0x7d,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x20,0x61,0x6e,0x64,0x20,0x63,0x6c,0x61,0x73,0x73,0x65,0x73,0x20,0x28,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x73,0x20,0x6c,0x61,0x73,0x74,0x20,0x61,0x6e,0x64,0x20,0x69,0x6e,0x20,0x70,0x72,0x65,0x63,0x65,0x64,0x65,0x6e,0x63,0x65,0x20,0x6f,0x72,0x64,0x65,0x72,0x29,0xa,0x2f,0x2f,0x20,0x63,0x6f,0x70,0x69,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x20,0x63,0x34,0xa,0x65,0x6e,0x75,0x6d,0x20,0x7b,0xa,0x20,0x20,0x4e,0x75,0x6d,0x20,0x3d,0x20,0x31,0x32,0x38,0x2c,0x20,0x46,0x75,0x6e,0x2c,0x20,0x53,0x79,0x73,0x2c,0x20,0x47,0x6c,0x6f,0x2c,0x20,0x4c,0x6f,0x63,0x2c,0x20,0x49,0x64,0x2c,0xa,0x20,0x20,0x43,0x68,0x61,0x72,0x2c,0x20,0x45,0x6c,0x73,0x65,0x2c,0x20,0x45,0x6e,0x75,0x6d,0x2c,0x20,0x49,0x66,0x2c,0x20,0x49,0x6e,0x74,0x2c,0x20,0x52,0x65,0x74,0x75,0x72,0x6e,0x2c,0x20,0x53,0x69,0x7a,0x65,0x6f,0x66,0x2c,0x20,0x57,0x68,0x69,0x6c,0x65,0x2c,0xa,0x20,0x20,0x41,0x73,0x73,0x69,0x67,0x6e,0x2c,0x20,0x43,0x6f,0x6e,0x64,0x2c,0x20,0x4c,0x6f,0x72,0x2c,0x20,0x4c,0x61,0x6e,0x2c,0x20,0x4f,0x72,0x2c,0x20,0x58,0x6f,0x72,0x2c,0x20,0x41,0x6e,0x64,0x2c,0x20,0x45,0x71,0x2c,0x20,0x4e,0x65,0x2c,0x20,0x4c,0x74,0x2c,0x20,0x47,0x74,0x2c,0x20,0x4c,0x65,0x2c,0x20,0x47,0x65,0x2c,0x20,0x53,0x68,0x6c,0x2c,0x20,0x53,0x68,0x72,0x2c,0x20,0x41,0x64,0x64,0x2c,0x20,0x53,0x75,0x62,0x2c,0x20,0x4d,0x75,0x6c,0x2c,0x20,0x44,0x69,0x76,0x2c,0x20,0x4d,0x6f,0x64,0x2c,0x20,0x49,0x6e,0x63,0x2c,0x20,0x44,0x65,0x63,0x2c,0x20,0x42,0x72,0x61,0x6b,0xa,0x7d,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x66,0x69,0x65,0x6c,0x64,0x73,0x20,0x6f,0x66,0x20,0x69,0x64,0x65,0x6e,0x74,0x69,0x66,0x69,0x65,0x72,0xa,0x65,0x6e,0x75,0x6d,0x20,0x7b,0x54,0x6f,0x6b,0x65,0x6e,0x2c,0x20,0x48,0x61,0x73,0x68,0x2c,0x20,0x4e,0x61,0x6d,0x65,0x2c,0x20,0x54,0x79,0x70,0x65,0x2c,0x20,0x43,0x6c,0x61,0x73,0x73,0x2c,0x20,0x56,0x61,0x6c,0x75,0x65,0x2c,0x20,0x42,0x54,0x79,0x70,0x65,0x2c,0x20,0x42,0x43,0x6c,0x61,0x73,0x73,0x2c,0x20,0x42,0x56,0x61,0x6c,0x75,0x65,0x2c,0x20,0x49,0x64,0x53,0x69,0x7a,0x65,0x7d,0x3b,0xa,0xa,0xa,0x2f,0x2f,0x20,0x74,0x79,0x70,0x65,0x73,0x20,0x6f,0x66,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x2f,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0xa,0x65,0x6e,0x75,0x6d,0x20,0x7b,0x20,0x43,0x48,0x41,0x52,0x2c,0x20,0x49,0x4e,0x54,0x2c,0x20,0x50,0x54,0x52,0x20,0x7d,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x74,0x79,0x70,0x65,0x20,0x6f,0x66,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x2e,0xa,0x65,0x6e,0x75,0x6d,0x20,0x7b,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x2c,0x20,0x4c,0x6f,0x63,0x61,0x6c,0x7d,0x3b,0xa,0xa,0x69,0x6e,0x74,0x20,0x2a,0x74,0x65,0x78,0x74,0x2c,0x20,0x2f,0x2f,0x20,0x74,0x65,0x78,0x74,0x20,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0xa,0x20,0x20,0x20,0x20,0x2a,0x73,0x74,0x61,0x63,0x6b,0x3b,0x2f,0x2f,0x20,0x73,0x74,0x61,0x63,0x6b,0xa,0x69,0x6e,0x74,0x20,0x2a,0x20,0x6f,0x6c,0x64,0x5f,0x74,0x65,0x78,0x74,0x3b,0x20,0x2f,0x2f,0x20,0x66,0x6f,0x72,0x20,0x64,0x75,0x6d,0x70,0x20,0x74,0x65,0x78,0x74,0x20,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0xa,0x63,0x68,0x61,0x72,0x20,0x2a,0x64,0x61,0x74,0x61,0x3b,0x20,0x2f,0x2f,0x20,0x64,0x61,0x74,0x61,0x20,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0xa,0x69,0x6e,0x74,0x20,0x2a,0x69,0x64,0x6d,0x61,0x69,0x6e,0x3b,0xa,0xa,0x63,0x68,0x61,0x72,0x20,0x2a,0x73,0x72,0x63,0x2c,0x20,0x2a,0x6f,0x6c,0x64,0x5f,0x73,0x72,0x63,0x3b,0x20,0x20,0x2f,0x2f,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x74,0x6f,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x3b,0xa,0xa,0x69,0x6e,0x74,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x3b,0x20,0x2f,0x2f,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,0x6f,0x66,0x20,0x74,0x65,0x78,0x74,0x2f,0x64,0x61,0x74,0x61,0x2f,0x73,0x74,0x61,0x63,0x6b,0xa,0x69,0x6e,0x74,0x20,0x2a,0x70,0x63,0x2c,0x20,0x2a,0x62,0x70,0x2c,0x20,0x2a,0x73,0x70,0x2c,0x20,0x61,0x78,0x2c,0x20,0x63,0x79,0x63,0x6c,0x65,0x3b,0x20,0x2f,0x2f,0x20,0x76,0x69,0x72,0x74,0x75,0x61,0x6c,0x20,0x6d,0x61,0x63,0x68,0x69,0x6e,0x65,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x73,0xa,0xa,0x69,0x6e,0x74,0x20,0x2a,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x2c,0x20,0x2f,0x2f,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x70,0x61,0x72,0x73,0x65,0x64,0x20,0x49,0x44,0xa,0x20,0x20,0x20,0x20,0x2a,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x2c,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x74,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x69,0x6e,0x65,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x20,0x6f,0x66,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x64,0x65,0xa,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x3b,0x20,0x20,0x20,0x2f,0x2f,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x6f,0x66,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x28,0x6d,0x61,0x69,0x6e,0x6c,0x79,0x20,0x66,0x6f,0x72,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x29,0xa,0xa,0x69,0x6e,0x74,0x20,0x62,0x61,0x73,0x65,0x74,0x79,0x70,0x65,0x3b,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x74,0x79,0x70,0x65,0x20,0x6f,0x66,0x20,0x61,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x6d,0x61,0x6b,0x65,0x20,0x69,0x74,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x66,0x6f,0x72,0x20,0x63,0x6f,0x6e,0x76,0x65,0x6e,0x69,0x65,0x6e,0x63,0x65,0xa,0x69,0x6e,0x74,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x3b,0x20,0x20,0x20,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x74,0x79,0x70,0x65,0x20,0x6f,0x66,0x20,0x61,0x6e,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0xa,0xa,0x2f,0x2f,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x72,0x61,0x6d,0x65,0xa,0x2f,0x2f,0xa,0x2f,0x2f,0x20,0x30,0x3a,0x20,0x61,0x72,0x67,0x20,0x31,0xa,0x2f,0x2f,0x20,0x31,0x3a,0x20,0x61,0x72,0x67,0x20,0x32,0xa,0x2f,0x2f,0x20,0x32,0x3a,0x20,0x61,0x72,0x67,0x20,0x33,0xa,0x2f,0x2f,0x20,0x33,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0xa,0x2f,0x2f,0x20,0x34,0x3a,0x20,0x6f,0x6c,0x64,0x20,0x62,0x70,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x20,0x3c,0x2d,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x66,0x5f,0x62,0x70,0xa,0x2f,0x2f,0x20,0x35,0x3a,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x20,0x31,0xa,0x2f,0x2f,0x20,0x36,0x3a,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x20,0x32,0xa,0x69,0x6e,0x74,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x66,0x5f,0x62,0x70,0x3b,0x20,0x2f,0x2f,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,0x6f,0x66,0x20,0x62,0x70,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x6f,0x6e,0x20,0x73,0x74,0x61,0x63,0x6b,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x6c,0x61,0x73,0x74,0x5f,0x70,0x6f,0x73,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x68,0x61,0x73,0x68,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x2a,0x73,0x72,0x63,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x2b,0x73,0x72,0x63,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x79,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x72,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x69,0x6e,0x66,0x6f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x25,0x2e,0x2a,0x73,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x73,0x72,0x63,0x2d,0x6f,0x6c,0x64,0x5f,0x73,0x72,0x63,0x2c,0x20,0x6f,0x6c,0x64,0x5f,0x73,0x72,0x63,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x6c,0x64,0x5f,0x73,0x72,0x63,0x20,0x3d,0x20,0x73,0x72,0x63,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x6f,0x6c,0x64,0x5f,0x74,0x65,0x78,0x74,0x20,0x3c,0x20,0x74,0x65,0x78,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x38,0x2e,0x34,0x73,0x22,0x2c,0x20,0x26,0x20,0x22,0x4c,0x45,0x41,0x20,0x2c,0x49,0x4d,0x4d,0x20,0x2c,0x4a,0x4d,0x50,0x20,0x2c,0x43,0x41,0x4c,0x4c,0x2c,0x4a,0x5a,0x20,0x20,0x2c,0x4a,0x4e,0x5a,0x20,0x2c,0x45,0x4e,0x54,0x20,0x2c,0x41,0x44,0x4a,0x20,0x2c,0x4c,0x45,0x56,0x20,0x2c,0x4c,0x49,0x20,0x20,0x2c,0x4c,0x43,0x20,0x20,0x2c,0x53,0x49,0x20,0x20,0x2c,0x53,0x43,0x20,0x20,0x2c,0x50,0x55,0x53,0x48,0x2c,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x4f,0x52,0x20,0x20,0x2c,0x58,0x4f,0x52,0x20,0x2c,0x41,0x4e,0x44,0x20,0x2c,0x45,0x51,0x20,0x20,0x2c,0x4e,0x45,0x20,0x20,0x2c,0x4c,0x54,0x20,0x20,0x2c,0x47,0x54,0x20,0x20,0x2c,0x4c,0x45,0x20,0x20,0x2c,0x47,0x45,0x20,0x20,0x2c,0x53,0x48,0x4c,0x20,0x2c,0x53,0x48,0x52,0x20,0x2c,0x41,0x44,0x44,0x20,0x2c,0x53,0x55,0x42,0x20,0x2c,0x4d,0x55,0x4c,0x20,0x2c,0x44,0x49,0x56,0x20,0x2c,0x4d,0x4f,0x44,0x20,0x2c,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x4f,0x50,0x45,0x4e,0x2c,0x52,0x45,0x41,0x44,0x2c,0x43,0x4c,0x4f,0x53,0x2c,0x50,0x52,0x54,0x46,0x2c,0x4d,0x41,0x4c,0x43,0x2c,0x4d,0x53,0x45,0x54,0x2c,0x4d,0x43,0x4d,0x50,0x2c,0x45,0x58,0x49,0x54,0x22,0x5b,0x2a,0x2b,0x2b,0x6f,0x6c,0x64,0x5f,0x74,0x65,0x78,0x74,0x20,0x2a,0x20,0x35,0x5d,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x6f,0x6c,0x64,0x5f,0x74,0x65,0x78,0x74,0x20,0x3c,0x3d,0x20,0x41,0x44,0x4a,0x29,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x20,0x25,0x64,0x5c,0x6e,0x22,0x2c,0x20,0x2a,0x2b,0x2b,0x6f,0x6c,0x64,0x5f,0x74,0x65,0x78,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x2b,0x6c,0x69,0x6e,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x23,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x6b,0x69,0x70,0x20,0x6d,0x61,0x63,0x72,0x6f,0x2c,0x20,0x62,0x65,0x63,0x61,0x75,0x73,0x65,0x20,0x77,0x65,0x20,0x77,0x69,0x6c,0x6c,0x20,0x6e,0x6f,0x74,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x20,0x69,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x21,0x3d,0x20,0x30,0x20,0x26,0x26,0x20,0x2a,0x73,0x72,0x63,0x20,0x21,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3e,0x3d,0x20,0x27,0x61,0x27,0x20,0x26,0x26,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3c,0x3d,0x20,0x27,0x7a,0x27,0x29,0x20,0x7c,0x7c,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3e,0x3d,0x20,0x27,0x41,0x27,0x20,0x26,0x26,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3c,0x3d,0x20,0x27,0x5a,0x27,0x29,0x20,0x7c,0x7c,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x5f,0x27,0x29,0x29,0x20,0x7b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x69,0x64,0x65,0x6e,0x74,0x69,0x66,0x69,0x65,0x72,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x61,0x73,0x74,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x72,0x63,0x20,0x2d,0x20,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x61,0x73,0x68,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x2a,0x73,0x72,0x63,0x20,0x3e,0x3d,0x20,0x27,0x61,0x27,0x20,0x26,0x26,0x20,0x2a,0x73,0x72,0x63,0x20,0x3c,0x3d,0x20,0x27,0x7a,0x27,0x29,0x20,0x7c,0x7c,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3e,0x3d,0x20,0x27,0x41,0x27,0x20,0x26,0x26,0x20,0x2a,0x73,0x72,0x63,0x20,0x3c,0x3d,0x20,0x27,0x5a,0x27,0x29,0x20,0x7c,0x7c,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3e,0x3d,0x20,0x27,0x30,0x27,0x20,0x26,0x26,0x20,0x2a,0x73,0x72,0x63,0x20,0x3c,0x3d,0x20,0x27,0x39,0x27,0x29,0x20,0x7c,0x7c,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x5f,0x27,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x61,0x73,0x68,0x20,0x3d,0x20,0x68,0x61,0x73,0x68,0x20,0x2a,0x20,0x31,0x34,0x37,0x20,0x2b,0x20,0x2a,0x73,0x72,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x6f,0x6f,0x6b,0x20,0x66,0x6f,0x72,0x20,0x65,0x78,0x69,0x73,0x74,0x69,0x6e,0x67,0x20,0x69,0x64,0x65,0x6e,0x74,0x69,0x66,0x69,0x65,0x72,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x73,0x65,0x61,0x72,0x63,0x68,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x20,0x3d,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x6f,0x6b,0x65,0x6e,0x5d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x48,0x61,0x73,0x68,0x5d,0x20,0x3d,0x3d,0x20,0x68,0x61,0x73,0x68,0x20,0x26,0x26,0x20,0x21,0x6d,0x65,0x6d,0x63,0x6d,0x70,0x28,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x4e,0x61,0x6d,0x65,0x5d,0x2c,0x20,0x6c,0x61,0x73,0x74,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x73,0x72,0x63,0x20,0x2d,0x20,0x6c,0x61,0x73,0x74,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x66,0x6f,0x75,0x6e,0x64,0x20,0x6f,0x6e,0x65,0x2c,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x6f,0x6b,0x65,0x6e,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x20,0x2b,0x20,0x49,0x64,0x53,0x69,0x7a,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x74,0x6f,0x72,0x65,0x20,0x6e,0x65,0x77,0x20,0x49,0x44,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x4e,0x61,0x6d,0x65,0x5d,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x6c,0x61,0x73,0x74,0x5f,0x70,0x6f,0x73,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x48,0x61,0x73,0x68,0x5d,0x20,0x3d,0x20,0x68,0x61,0x73,0x68,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x6f,0x6b,0x65,0x6e,0x5d,0x20,0x3d,0x20,0x49,0x64,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3e,0x3d,0x20,0x27,0x30,0x27,0x20,0x26,0x26,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3c,0x3d,0x20,0x27,0x39,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x2c,0x20,0x74,0x68,0x72,0x65,0x65,0x20,0x6b,0x69,0x6e,0x64,0x73,0x3a,0x20,0x64,0x65,0x63,0x28,0x31,0x32,0x33,0x29,0x20,0x68,0x65,0x78,0x28,0x30,0x78,0x31,0x32,0x33,0x29,0x20,0x6f,0x63,0x74,0x28,0x30,0x31,0x37,0x29,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x2d,0x20,0x27,0x30,0x27,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3e,0x20,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x64,0x65,0x63,0x2c,0x20,0x73,0x74,0x61,0x72,0x74,0x73,0x20,0x77,0x69,0x74,0x68,0x20,0x5b,0x31,0x2d,0x39,0x5d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3e,0x3d,0x20,0x27,0x30,0x27,0x20,0x26,0x26,0x20,0x2a,0x73,0x72,0x63,0x20,0x3c,0x3d,0x20,0x27,0x39,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x2a,0x31,0x30,0x20,0x2b,0x20,0x2a,0x73,0x72,0x63,0x2b,0x2b,0x20,0x2d,0x20,0x27,0x30,0x27,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x74,0x61,0x72,0x74,0x73,0x20,0x77,0x69,0x74,0x68,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x20,0x30,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x78,0x27,0x20,0x7c,0x7c,0x20,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x58,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x68,0x65,0x78,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x2a,0x2b,0x2b,0x73,0x72,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3e,0x3d,0x20,0x27,0x30,0x27,0x20,0x26,0x26,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3c,0x3d,0x20,0x27,0x39,0x27,0x29,0x20,0x7c,0x7c,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3e,0x3d,0x20,0x27,0x61,0x27,0x20,0x26,0x26,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3c,0x3d,0x20,0x27,0x66,0x27,0x29,0x20,0x7c,0x7c,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3e,0x3d,0x20,0x27,0x41,0x27,0x20,0x26,0x26,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3c,0x3d,0x20,0x27,0x46,0x27,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x2a,0x20,0x31,0x36,0x20,0x2b,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x26,0x20,0x31,0x35,0x29,0x20,0x2b,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3e,0x3d,0x20,0x27,0x41,0x27,0x20,0x3f,0x20,0x39,0x20,0x3a,0x20,0x30,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x2a,0x2b,0x2b,0x73,0x72,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6f,0x63,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3e,0x3d,0x20,0x27,0x30,0x27,0x20,0x26,0x26,0x20,0x2a,0x73,0x72,0x63,0x20,0x3c,0x3d,0x20,0x27,0x37,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x2a,0x38,0x20,0x2b,0x20,0x2a,0x73,0x72,0x63,0x2b,0x2b,0x20,0x2d,0x20,0x27,0x30,0x27,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4e,0x75,0x6d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2f,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x2f,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x6b,0x69,0x70,0x20,0x63,0x6f,0x6d,0x6d,0x65,0x6e,0x74,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x21,0x3d,0x20,0x30,0x20,0x26,0x26,0x20,0x2a,0x73,0x72,0x63,0x20,0x21,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x2b,0x73,0x72,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x64,0x69,0x76,0x69,0x64,0x65,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x44,0x69,0x76,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x22,0x27,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x5c,0x27,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x6c,0x69,0x74,0x65,0x72,0x61,0x6c,0x2c,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x6c,0x79,0x2c,0x20,0x74,0x68,0x65,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x65,0x64,0x20,0x65,0x73,0x63,0x61,0x70,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x69,0x73,0x20,0x27,0x5c,0x6e,0x27,0x2c,0x20,0x73,0x74,0x6f,0x72,0x65,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x6c,0x69,0x74,0x65,0x72,0x61,0x6c,0x20,0x69,0x6e,0x74,0x6f,0x20,0x64,0x61,0x74,0x61,0x2e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x61,0x73,0x74,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x64,0x61,0x74,0x61,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x21,0x3d,0x20,0x30,0x20,0x26,0x26,0x20,0x2a,0x73,0x72,0x63,0x20,0x21,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x2a,0x73,0x72,0x63,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x3d,0x20,0x27,0x5c,0x5c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x73,0x63,0x61,0x70,0x65,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x2a,0x73,0x72,0x63,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x3d,0x20,0x27,0x6e,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x22,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x64,0x61,0x74,0x61,0x2b,0x2b,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x66,0x20,0x69,0x74,0x20,0x69,0x73,0x20,0x61,0x20,0x73,0x69,0x6e,0x67,0x6c,0x65,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x2c,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x4e,0x75,0x6d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x22,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x6c,0x61,0x73,0x74,0x5f,0x70,0x6f,0x73,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4e,0x75,0x6d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x3d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x27,0x3d,0x3d,0x27,0x20,0x61,0x6e,0x64,0x20,0x27,0x3d,0x27,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x3d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x45,0x71,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x41,0x73,0x73,0x69,0x67,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2b,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x27,0x2b,0x27,0x20,0x61,0x6e,0x64,0x20,0x27,0x2b,0x2b,0x27,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x2b,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x49,0x6e,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x41,0x64,0x64,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x27,0x2d,0x27,0x20,0x61,0x6e,0x64,0x20,0x27,0x2d,0x2d,0x27,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x2d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x44,0x65,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x53,0x75,0x62,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x21,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x27,0x21,0x3d,0x27,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x3d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4e,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x3c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x27,0x3c,0x3d,0x27,0x2c,0x20,0x27,0x3c,0x3c,0x27,0x20,0x6f,0x72,0x20,0x27,0x3c,0x27,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x3d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4c,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x3c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x53,0x68,0x6c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4c,0x74,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x3e,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x27,0x3e,0x3d,0x27,0x2c,0x20,0x27,0x3e,0x3e,0x27,0x20,0x6f,0x72,0x20,0x27,0x3e,0x27,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x3d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x47,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x3e,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x53,0x68,0x72,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x47,0x74,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x7c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x27,0x7c,0x27,0x20,0x6f,0x72,0x20,0x27,0x7c,0x7c,0x27,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x7c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4c,0x6f,0x72,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4f,0x72,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x26,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x27,0x26,0x27,0x20,0x61,0x6e,0x64,0x20,0x27,0x26,0x26,0x27,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x73,0x72,0x63,0x20,0x3d,0x3d,0x20,0x27,0x26,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4c,0x61,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x41,0x6e,0x64,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x5e,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x58,0x6f,0x72,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x25,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4d,0x6f,0x64,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2a,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x4d,0x75,0x6c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x5b,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x42,0x72,0x61,0x6b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x3f,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x43,0x6f,0x6e,0x64,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x7e,0x27,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x3b,0x27,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x7b,0x27,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x7d,0x27,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x28,0x27,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x29,0x27,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x5d,0x27,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2c,0x27,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x3a,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x6c,0x79,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x68,0x65,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x61,0x73,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x69,0x6e,0x74,0x20,0x74,0x6b,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x74,0x6b,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x3a,0x20,0x25,0x64,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x74,0x6b,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x7d,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x69,0x6e,0x74,0x20,0x6c,0x65,0x76,0x65,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x73,0x20,0x68,0x61,0x76,0x65,0x20,0x76,0x61,0x72,0x69,0x6f,0x75,0x73,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2e,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x62,0x75,0x74,0x20,0x6d,0x61,0x6a,0x6f,0x72,0x6c,0x79,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x64,0x69,0x76,0x69,0x64,0x65,0x64,0x20,0x69,0x6e,0x74,0x6f,0x20,0x74,0x77,0x6f,0x20,0x70,0x61,0x72,0x74,0x73,0x3a,0x20,0x75,0x6e,0x69,0x74,0x20,0x61,0x6e,0x64,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x66,0x6f,0x72,0x20,0x65,0x78,0x61,0x6d,0x70,0x6c,0x65,0x20,0x60,0x28,0x63,0x68,0x61,0x72,0x29,0x20,0x2a,0x61,0x5b,0x31,0x30,0x5d,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x20,0x66,0x75,0x6e,0x63,0x28,0x62,0x20,0x3e,0x20,0x30,0x20,0x3f,0x20,0x31,0x30,0x20,0x3a,0x20,0x32,0x30,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x60,0x61,0x5b,0x31,0x30,0x5d,0x60,0x20,0x69,0x73,0x20,0x61,0x6e,0x20,0x75,0x6e,0x69,0x74,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x60,0x2a,0x60,0x20,0x69,0x73,0x20,0x61,0x6e,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x2e,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x60,0x66,0x75,0x6e,0x63,0x28,0x2e,0x2e,0x2e,0x29,0x60,0x20,0x69,0x6e,0x20,0x74,0x6f,0x74,0x61,0x6c,0x20,0x69,0x73,0x20,0x61,0x6e,0x20,0x75,0x6e,0x69,0x74,0x2e,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x6f,0x20,0x77,0x65,0x20,0x73,0x68,0x6f,0x75,0x6c,0x64,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x74,0x68,0x6f,0x73,0x65,0x20,0x75,0x6e,0x69,0x74,0x20,0x61,0x6e,0x64,0x20,0x75,0x6e,0x61,0x72,0x79,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x73,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x6e,0x20,0x74,0x68,0x65,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x6f,0x6e,0x65,0x73,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x6c,0x73,0x6f,0x20,0x74,0x68,0x65,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6c,0x6c,0x6f,0x77,0x69,0x6e,0x67,0x20,0x74,0x79,0x70,0x65,0x73,0x3a,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x31,0x2e,0x20,0x75,0x6e,0x69,0x74,0x5f,0x75,0x6e,0x61,0x72,0x79,0x20,0x3a,0x3a,0x3d,0x20,0x75,0x6e,0x69,0x74,0x20,0x7c,0x20,0x75,0x6e,0x69,0x74,0x20,0x75,0x6e,0x61,0x72,0x79,0x5f,0x6f,0x70,0x20,0x7c,0x20,0x75,0x6e,0x61,0x72,0x79,0x5f,0x6f,0x70,0x20,0x75,0x6e,0x69,0x74,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x32,0x2e,0x20,0x65,0x78,0x70,0x72,0x20,0x3a,0x3a,0x3d,0x20,0x75,0x6e,0x69,0x74,0x5f,0x75,0x6e,0x61,0x72,0x79,0x20,0x28,0x62,0x69,0x6e,0x5f,0x6f,0x70,0x20,0x75,0x6e,0x69,0x74,0x5f,0x75,0x6e,0x61,0x72,0x79,0x20,0x2e,0x2e,0x2e,0x29,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x74,0x5f,0x75,0x6e,0x61,0x72,0x79,0x28,0x29,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x2a,0x69,0x64,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x2a,0x61,0x64,0x64,0x72,0x3b,0xa,0x20,0x20,0x20,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x74,0x6f,0x6b,0x65,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x75,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x45,0x4f,0x46,0x20,0x6f,0x66,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4e,0x75,0x6d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4e,0x75,0x6d,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x22,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x6f,0x75,0x73,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x22,0x61,0x62,0x63,0x22,0x20,0x22,0x61,0x62,0x63,0x22,0xa,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x22,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x74,0x6f,0x72,0x65,0x20,0x74,0x68,0x65,0x20,0x72,0x65,0x73,0x74,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x22,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x22,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x70,0x70,0x65,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x65,0x6e,0x64,0x20,0x6f,0x66,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x27,0x5c,0x30,0x27,0x2c,0x20,0x61,0x6c,0x6c,0x20,0x74,0x68,0x65,0x20,0x64,0x61,0x74,0x61,0x20,0x61,0x72,0x65,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x30,0x2c,0x20,0x73,0x6f,0x20,0x6a,0x75,0x73,0x74,0x20,0x6d,0x6f,0x76,0x65,0x20,0x64,0x61,0x74,0x61,0x20,0x6f,0x6e,0x65,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x2e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x61,0x20,0x3d,0x20,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x28,0x28,0x28,0x69,0x6e,0x74,0x29,0x64,0x61,0x74,0x61,0x20,0x2b,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x29,0x20,0x26,0x20,0x28,0x2d,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x29,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x50,0x54,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x53,0x69,0x7a,0x65,0x6f,0x66,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x69,0x73,0x20,0x61,0x63,0x74,0x75,0x61,0x6c,0x6c,0x79,0x20,0x61,0x6e,0x20,0x75,0x6e,0x61,0x72,0x79,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6e,0x6f,0x77,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x60,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x60,0x2c,0x20,0x60,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x63,0x68,0x61,0x72,0x29,0x60,0x20,0x61,0x6e,0x64,0x20,0x60,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x2a,0x2e,0x2e,0x2e,0x29,0x60,0x20,0x61,0x72,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x65,0x64,0x2e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x53,0x69,0x7a,0x65,0x6f,0x66,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x28,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x49,0x6e,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x43,0x68,0x61,0x72,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x43,0x68,0x61,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x43,0x48,0x41,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4d,0x75,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4d,0x75,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x2b,0x20,0x50,0x54,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x29,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x43,0x48,0x41,0x52,0x29,0x20,0x3f,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x63,0x68,0x61,0x72,0x29,0x20,0x3a,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x74,0x68,0x65,0x72,0x65,0x20,0x61,0x72,0x65,0x20,0x73,0x65,0x76,0x65,0x72,0x61,0x6c,0x20,0x74,0x79,0x70,0x65,0x20,0x77,0x68,0x65,0x6e,0x20,0x6f,0x63,0x63,0x75,0x72,0x73,0x20,0x74,0x6f,0x20,0x49,0x64,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x62,0x75,0x74,0x20,0x74,0x68,0x69,0x73,0x20,0x69,0x73,0x20,0x75,0x6e,0x69,0x74,0x2c,0x20,0x73,0x6f,0x20,0x69,0x74,0x20,0x63,0x61,0x6e,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x31,0x2e,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x61,0x6c,0x6c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x32,0x2e,0x20,0x45,0x6e,0x75,0x6d,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x33,0x2e,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x2f,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x49,0x64,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x64,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x28,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x61,0x6c,0x6c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x28,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x73,0x73,0x20,0x69,0x6e,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6d,0x70,0x20,0x3d,0x20,0x30,0x3b,0x20,0x2f,0x2f,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x20,0x6f,0x66,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x29,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6d,0x70,0x20,0x2b,0x2b,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x2c,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x29,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x3d,0x20,0x53,0x79,0x73,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x79,0x73,0x74,0x65,0x6d,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x3d,0x20,0x46,0x75,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x61,0x6c,0x6c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x43,0x41,0x4c,0x4c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x61,0x6c,0x6c,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x63,0x6c,0x65,0x61,0x6e,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,0x66,0x6f,0x72,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6d,0x70,0x20,0x3e,0x20,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x41,0x44,0x4a,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x3d,0x20,0x4e,0x75,0x6d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6e,0x75,0x6d,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x3d,0x20,0x4c,0x6f,0x63,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4c,0x45,0x41,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x66,0x5f,0x62,0x70,0x20,0x2d,0x20,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x3d,0x20,0x47,0x6c,0x6f,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x62,0x65,0x68,0x61,0x76,0x69,0x6f,0x75,0x72,0x20,0x69,0x73,0x20,0x74,0x6f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x74,0x68,0x65,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x69,0x73,0x20,0x73,0x74,0x6f,0x72,0x65,0x64,0x20,0x69,0x6e,0x20,0x60,0x61,0x78,0x60,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x43,0x48,0x41,0x52,0x29,0x20,0x3f,0x20,0x4c,0x43,0x20,0x3a,0x20,0x4c,0x49,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x28,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x63,0x61,0x73,0x74,0x20,0x6f,0x72,0x20,0x70,0x61,0x72,0x65,0x6e,0x74,0x68,0x65,0x73,0x69,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x28,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x74,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x43,0x68,0x61,0x72,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6d,0x70,0x20,0x3d,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x43,0x68,0x61,0x72,0x29,0x20,0x3f,0x20,0x43,0x48,0x41,0x52,0x20,0x3a,0x20,0x49,0x4e,0x54,0x3b,0x20,0x2f,0x2f,0x20,0x63,0x61,0x73,0x74,0x20,0x74,0x79,0x70,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4d,0x75,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4d,0x75,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6d,0x70,0x20,0x3d,0x20,0x74,0x6d,0x70,0x20,0x2b,0x20,0x50,0x54,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x29,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x63,0x61,0x73,0x74,0x20,0x68,0x61,0x73,0x20,0x70,0x72,0x65,0x63,0x65,0x64,0x65,0x6e,0x63,0x65,0x20,0x61,0x73,0x20,0x49,0x6e,0x63,0x28,0x2b,0x2b,0x29,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x70,0x61,0x72,0x65,0x6e,0x74,0x68,0x65,0x73,0x69,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x29,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4d,0x75,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x64,0x65,0x72,0x65,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x20,0x2a,0x3c,0x61,0x64,0x64,0x72,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4d,0x75,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x64,0x65,0x72,0x65,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x20,0x68,0x61,0x73,0x20,0x74,0x68,0x65,0x20,0x73,0x61,0x6d,0x65,0x20,0x70,0x72,0x65,0x63,0x65,0x64,0x65,0x6e,0x63,0x65,0x20,0x61,0x73,0x20,0x49,0x6e,0x63,0x28,0x2b,0x2b,0x29,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x50,0x54,0x52,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x2d,0x20,0x50,0x54,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x64,0x65,0x72,0x65,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x43,0x48,0x41,0x52,0x29,0x20,0x3f,0x20,0x4c,0x43,0x20,0x3a,0x20,0x4c,0x49,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x41,0x6e,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x67,0x65,0x74,0x20,0x74,0x68,0x65,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x6f,0x66,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x41,0x6e,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x67,0x65,0x74,0x20,0x74,0x68,0x65,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x6f,0x66,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x3d,0x20,0x4c,0x43,0x20,0x7c,0x7c,0x20,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x3d,0x20,0x4c,0x49,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x20,0x2d,0x2d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x6f,0x66,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x2b,0x20,0x50,0x54,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x21,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6e,0x6f,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x21,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0x2c,0x20,0x75,0x73,0x65,0x20,0x3c,0x65,0x78,0x70,0x72,0x3e,0x20,0x3d,0x3d,0x20,0x30,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x45,0x51,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x7e,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x62,0x69,0x74,0x77,0x69,0x73,0x65,0x20,0x6e,0x6f,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x7e,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0x2c,0x20,0x75,0x73,0x65,0x20,0x3c,0x65,0x78,0x70,0x72,0x3e,0x20,0x58,0x4f,0x52,0x20,0x2d,0x31,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x58,0x4f,0x52,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x41,0x64,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x2b,0x76,0x61,0x72,0x2c,0x20,0x64,0x6f,0x20,0x6e,0x6f,0x74,0x68,0x69,0x6e,0x67,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x41,0x64,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x53,0x75,0x62,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x2d,0x76,0x61,0x72,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x53,0x75,0x62,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4e,0x75,0x6d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x2d,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4e,0x75,0x6d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4d,0x55,0x4c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x63,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x44,0x65,0x63,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6d,0x70,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x3d,0x20,0x4c,0x43,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0x20,0x20,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x64,0x75,0x70,0x6c,0x69,0x63,0x61,0x74,0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4c,0x43,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x3d,0x20,0x4c,0x49,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4c,0x49,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x6c,0x76,0x61,0x6c,0x75,0x65,0x20,0x6f,0x66,0x20,0x70,0x72,0x65,0x2d,0x69,0x6e,0x63,0x72,0x65,0x6d,0x65,0x6e,0x74,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x50,0x54,0x52,0x29,0x20,0x3f,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x20,0x3a,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x63,0x68,0x61,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x74,0x6d,0x70,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x63,0x29,0x20,0x3f,0x20,0x41,0x44,0x44,0x20,0x3a,0x20,0x53,0x55,0x42,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x43,0x48,0x41,0x52,0x29,0x20,0x3f,0x20,0x53,0x43,0x20,0x3a,0x20,0x53,0x49,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x20,0x61,0x6e,0x64,0x20,0x70,0x6f,0x73,0x74,0x66,0x69,0x78,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x73,0x2e,0xa,0x20,0x20,0x20,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3e,0x3d,0x20,0x6c,0x65,0x76,0x65,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x20,0x61,0x63,0x63,0x6f,0x72,0x64,0x69,0x6e,0x67,0x20,0x74,0x6f,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x6f,0x72,0x27,0x73,0x20,0x70,0x72,0x65,0x63,0x65,0x64,0x65,0x6e,0x63,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6d,0x70,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x76,0x61,0x72,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x3d,0x20,0x4c,0x43,0x20,0x7c,0x7c,0x20,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x3d,0x20,0x4c,0x49,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0x20,0x2f,0x2f,0x20,0x73,0x61,0x76,0x65,0x20,0x74,0x68,0x65,0x20,0x6c,0x76,0x61,0x6c,0x75,0x65,0x27,0x73,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x6c,0x76,0x61,0x6c,0x75,0x65,0x20,0x69,0x6e,0x20,0x61,0x73,0x73,0x69,0x67,0x6e,0x6d,0x65,0x6e,0x74,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x43,0x48,0x41,0x52,0x29,0x20,0x3f,0x20,0x53,0x43,0x20,0x3a,0x20,0x53,0x49,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x43,0x6f,0x6e,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x78,0x70,0x72,0x20,0x3f,0x20,0x61,0x20,0x3a,0x20,0x62,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x43,0x6f,0x6e,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4a,0x5a,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x64,0x72,0x20,0x3d,0x20,0x2b,0x2b,0x74,0x65,0x78,0x74,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x3a,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x3a,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x20,0x63,0x6f,0x6c,0x6f,0x6e,0x20,0x69,0x6e,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x61,0x64,0x64,0x72,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x74,0x65,0x78,0x74,0x20,0x2b,0x20,0x33,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4a,0x4d,0x50,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x64,0x72,0x20,0x3d,0x20,0x2b,0x2b,0x74,0x65,0x78,0x74,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x43,0x6f,0x6e,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x61,0x64,0x64,0x72,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x74,0x65,0x78,0x74,0x20,0x2b,0x20,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4c,0x6f,0x72,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x6f,0x67,0x69,0x63,0x20,0x6f,0x72,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4c,0x6f,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4a,0x4e,0x5a,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x64,0x72,0x20,0x3d,0x20,0x2b,0x2b,0x74,0x65,0x78,0x74,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x4c,0x61,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x61,0x64,0x64,0x72,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x74,0x65,0x78,0x74,0x20,0x2b,0x20,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4c,0x61,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x6f,0x67,0x69,0x63,0x20,0x61,0x6e,0x64,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4c,0x61,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4a,0x5a,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x64,0x72,0x20,0x3d,0x20,0x2b,0x2b,0x74,0x65,0x78,0x74,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x4f,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x61,0x64,0x64,0x72,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x74,0x65,0x78,0x74,0x20,0x2b,0x20,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4f,0x72,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x62,0x69,0x74,0x77,0x69,0x73,0x65,0x20,0x6f,0x72,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4f,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x58,0x6f,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4f,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x58,0x6f,0x72,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x62,0x69,0x74,0x77,0x69,0x73,0x65,0x20,0x78,0x6f,0x72,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x58,0x6f,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x6e,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x58,0x4f,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x41,0x6e,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x62,0x69,0x74,0x77,0x69,0x73,0x65,0x20,0x61,0x6e,0x64,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x41,0x6e,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x45,0x71,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x41,0x4e,0x44,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x45,0x71,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x71,0x75,0x61,0x6c,0x20,0x3d,0x3d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x45,0x71,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x4e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x45,0x51,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4e,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6e,0x6f,0x74,0x20,0x65,0x71,0x75,0x61,0x6c,0x20,0x21,0x3d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x4c,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4e,0x45,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4c,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x65,0x73,0x73,0x20,0x74,0x68,0x61,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4c,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x53,0x68,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4c,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x47,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x67,0x72,0x65,0x61,0x74,0x65,0x72,0x20,0x74,0x68,0x61,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x47,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x53,0x68,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x47,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4c,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x65,0x73,0x73,0x20,0x74,0x68,0x61,0x6e,0x20,0x6f,0x72,0x20,0x65,0x71,0x75,0x61,0x6c,0x20,0x74,0x6f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4c,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x53,0x68,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4c,0x45,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x47,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x67,0x72,0x65,0x61,0x74,0x65,0x72,0x20,0x74,0x68,0x61,0x6e,0x20,0x6f,0x72,0x20,0x65,0x71,0x75,0x61,0x6c,0x20,0x74,0x6f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x47,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x53,0x68,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x47,0x45,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x53,0x68,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x6c,0x65,0x66,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x53,0x68,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x64,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x53,0x48,0x4c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x53,0x68,0x72,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x72,0x69,0x67,0x68,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x53,0x68,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x64,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x53,0x48,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x41,0x64,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x64,0x64,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x41,0x64,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x4d,0x75,0x6c,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x50,0x54,0x52,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x74,0x79,0x70,0x65,0x2c,0x20,0x61,0x6e,0x64,0x20,0x6e,0x6f,0x74,0x20,0x60,0x63,0x68,0x61,0x72,0x20,0x2a,0x60,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4d,0x55,0x4c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x41,0x44,0x44,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x53,0x75,0x62,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x75,0x62,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x53,0x75,0x62,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x4d,0x75,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6d,0x70,0x20,0x3e,0x20,0x50,0x54,0x52,0x20,0x26,0x26,0x20,0x74,0x6d,0x70,0x20,0x3d,0x3d,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x73,0x75,0x62,0x74,0x72,0x61,0x63,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x53,0x55,0x42,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x44,0x49,0x56,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6d,0x70,0x20,0x3e,0x20,0x50,0x54,0x52,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x6d,0x6f,0x76,0x65,0x6d,0x65,0x6e,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4d,0x55,0x4c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x53,0x55,0x42,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6e,0x75,0x6d,0x65,0x72,0x61,0x6c,0x20,0x73,0x75,0x62,0x74,0x72,0x61,0x63,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x53,0x55,0x42,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4d,0x75,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6d,0x75,0x6c,0x74,0x69,0x70,0x6c,0x79,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4d,0x75,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4d,0x55,0x4c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x44,0x69,0x76,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x64,0x69,0x76,0x69,0x64,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x44,0x69,0x76,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x44,0x49,0x56,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4d,0x6f,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x4d,0x6f,0x64,0x75,0x6c,0x6f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4d,0x6f,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x49,0x6e,0x63,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4d,0x4f,0x44,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x63,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x44,0x65,0x63,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x6f,0x73,0x74,0x66,0x69,0x78,0x20,0x69,0x6e,0x63,0x28,0x2b,0x2b,0x29,0x20,0x61,0x6e,0x64,0x20,0x64,0x65,0x63,0x28,0x2d,0x2d,0x29,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x77,0x65,0x20,0x77,0x69,0x6c,0x6c,0x20,0x69,0x6e,0x63,0x72,0x65,0x61,0x73,0x65,0x20,0x74,0x68,0x65,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x61,0x6e,0x64,0x20,0x64,0x65,0x63,0x72,0x65,0x61,0x73,0x65,0x20,0x69,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6f,0x6e,0x20,0x60,0x61,0x78,0x60,0x20,0x74,0x6f,0x20,0x67,0x65,0x74,0x20,0x69,0x74,0x73,0x20,0x6f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x76,0x61,0x6c,0x75,0x65,0x2e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x3d,0x20,0x4c,0x49,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4c,0x49,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x3d,0x20,0x4c,0x43,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4c,0x43,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x69,0x6e,0x20,0x69,0x6e,0x63,0x72,0x65,0x6d,0x65,0x6e,0x74,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x50,0x54,0x52,0x29,0x20,0x3f,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x20,0x3a,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x63,0x68,0x61,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x63,0x29,0x20,0x3f,0x20,0x41,0x44,0x44,0x20,0x3a,0x20,0x53,0x55,0x42,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x43,0x48,0x41,0x52,0x29,0x20,0x3f,0x20,0x53,0x43,0x20,0x3a,0x20,0x53,0x49,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x50,0x54,0x52,0x29,0x20,0x3f,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x20,0x3a,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x63,0x68,0x61,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x63,0x29,0x20,0x3f,0x20,0x53,0x55,0x42,0x20,0x3a,0x20,0x41,0x44,0x44,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x42,0x72,0x61,0x6b,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x72,0x72,0x61,0x79,0x20,0x61,0x63,0x63,0x65,0x73,0x73,0x20,0x76,0x61,0x72,0x5b,0x78,0x78,0x5d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x42,0x72,0x61,0x6b,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x5d,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6d,0x70,0x20,0x3e,0x20,0x50,0x54,0x52,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x2c,0x20,0x60,0x6e,0x6f,0x74,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x60,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x49,0x4d,0x4d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4d,0x55,0x4c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6d,0x70,0x20,0x3c,0x20,0x50,0x54,0x52,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x74,0x79,0x70,0x65,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x6d,0x70,0x20,0x2d,0x20,0x50,0x54,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x41,0x44,0x44,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x65,0x78,0x70,0x72,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x43,0x48,0x41,0x52,0x29,0x20,0x3f,0x20,0x4c,0x43,0x20,0x3a,0x20,0x4c,0x49,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x20,0x65,0x72,0x72,0x6f,0x72,0x2c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x25,0x64,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x74,0x68,0x65,0x72,0x65,0x20,0x61,0x72,0x65,0x20,0x38,0x20,0x6b,0x69,0x6e,0x64,0x73,0x20,0x6f,0x66,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0x20,0x68,0x65,0x72,0x65,0x3a,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x31,0x2e,0x20,0x69,0x66,0x20,0x28,0x2e,0x2e,0x2e,0x29,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x20,0x5b,0x65,0x6c,0x73,0x65,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x5d,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x32,0x2e,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x2e,0x2e,0x2e,0x29,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x33,0x2e,0x20,0x7b,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x34,0x2e,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0x78,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x35,0x2e,0x20,0x3c,0x65,0x6d,0x70,0x74,0x79,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x3b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x36,0x2e,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x3b,0x20,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x65,0x6e,0x64,0x20,0x77,0x69,0x74,0x68,0x20,0x73,0x65,0x6d,0x69,0x63,0x6f,0x6c,0x6f,0x6e,0x29,0xa,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x2a,0x61,0x2c,0x20,0x2a,0x62,0x3b,0x20,0x2f,0x2f,0x20,0x62,0x65,0x73,0x73,0x20,0x66,0x6f,0x72,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x20,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0xa,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x66,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x66,0x20,0x28,0x2e,0x2e,0x2e,0x29,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x20,0x5b,0x65,0x6c,0x73,0x65,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x5d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x2e,0x2e,0x2e,0x29,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x6f,0x6e,0x64,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4a,0x5a,0x20,0x61,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4a,0x4d,0x50,0x20,0x62,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x62,0x3a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x49,0x66,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x28,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x63,0x6f,0x6e,0x64,0x69,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x29,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0x20,0x66,0x6f,0x72,0x20,0x69,0x66,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4a,0x5a,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x2b,0x2b,0x74,0x65,0x78,0x74,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x45,0x6c,0x73,0x65,0x29,0x20,0x7b,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x65,0x6c,0x73,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x45,0x6c,0x73,0x65,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0x20,0x66,0x6f,0x72,0x20,0x4a,0x4d,0x50,0x20,0x42,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x62,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x74,0x65,0x78,0x74,0x20,0x2b,0x20,0x33,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4a,0x4d,0x50,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x2b,0x2b,0x74,0x65,0x78,0x74,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x62,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x74,0x65,0x78,0x74,0x20,0x2b,0x20,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x57,0x68,0x69,0x6c,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x3a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x3c,0x63,0x6f,0x6e,0x64,0x3e,0x29,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x63,0x6f,0x6e,0x64,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4a,0x5a,0x20,0x62,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4a,0x4d,0x50,0x20,0x61,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x62,0x3a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x3a,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x57,0x68,0x69,0x6c,0x65,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x20,0x2b,0x20,0x31,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x28,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x29,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4a,0x5a,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x2b,0x2b,0x74,0x65,0x78,0x74,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4a,0x4d,0x50,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x61,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x62,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x74,0x65,0x78,0x74,0x20,0x2b,0x20,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x7b,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x7b,0x20,0x3c,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x3e,0x20,0x2e,0x2e,0x2e,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x7b,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x7d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x7d,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x52,0x65,0x74,0x75,0x72,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x52,0x65,0x74,0x75,0x72,0x6e,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x3b,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x3b,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0x20,0x66,0x6f,0x72,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4c,0x45,0x56,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x3b,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x70,0x74,0x79,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x3b,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x20,0x3d,0x20,0x62,0x3b,0x20,0x6f,0x72,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x63,0x61,0x6c,0x6c,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x3b,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x65,0x6e,0x75,0x6d,0x5f,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x65,0x6e,0x75,0x6d,0x20,0x5b,0x69,0x64,0x5d,0x20,0x7b,0x20,0x61,0x20,0x3d,0x20,0x31,0x2c,0x20,0x62,0x20,0x3d,0x20,0x33,0x2c,0x20,0x2e,0x2e,0x2e,0x7d,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x7d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x49,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x65,0x6e,0x75,0x6d,0x20,0x69,0x64,0x65,0x6e,0x74,0x69,0x66,0x69,0x65,0x72,0x20,0x25,0x64,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x41,0x73,0x73,0x69,0x67,0x6e,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x69,0x6b,0x65,0x20,0x7b,0x61,0x3d,0x31,0x30,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x4e,0x75,0x6d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x65,0x6e,0x75,0x6d,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x72,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x5f,0x76,0x61,0x6c,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x20,0x4e,0x75,0x6d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x20,0x3d,0x20,0x69,0x2b,0x2b,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x79,0x70,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0xa,0x20,0x20,0x20,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x29,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x6e,0x74,0x20,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x2e,0x2e,0x2e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x49,0x6e,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x43,0x68,0x61,0x72,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x43,0x48,0x41,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x43,0x68,0x61,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x74,0x79,0x70,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4d,0x75,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4d,0x75,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x20,0x2b,0x20,0x50,0x54,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x20,0x6e,0x61,0x6d,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x49,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x3d,0x20,0x4c,0x6f,0x63,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x64,0x75,0x70,0x6c,0x69,0x63,0x61,0x74,0x65,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x49,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x74,0x6f,0x72,0x65,0x20,0x74,0x68,0x65,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x42,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x3b,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x20,0x3d,0x20,0x4c,0x6f,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x42,0x54,0x79,0x70,0x65,0x5d,0x20,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x3b,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x20,0x20,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x42,0x56,0x61,0x6c,0x75,0x65,0x5d,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x3b,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x20,0x20,0x3d,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x2b,0x2b,0x3b,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,0x6f,0x66,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x2c,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x66,0x5f,0x62,0x70,0x20,0x3d,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x2b,0x31,0x3b,0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x6f,0x64,0x79,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x74,0x79,0x70,0x65,0x20,0x66,0x75,0x6e,0x63,0x5f,0x6e,0x61,0x6d,0x65,0x20,0x28,0x2e,0x2e,0x2e,0x29,0x20,0x7b,0x2e,0x2e,0x2e,0x7d,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2d,0x2d,0x3e,0x7c,0x20,0x20,0x20,0x7c,0x3c,0x2d,0x2d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x2e,0x2e,0x2e,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x31,0x2e,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x32,0x2e,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x70,0x6f,0x73,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x3b,0x20,0x2f,0x2f,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x61,0x63,0x6b,0x2e,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x79,0x70,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x66,0x5f,0x62,0x70,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x74,0x20,0x7c,0x7c,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x43,0x68,0x61,0x72,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x6a,0x75,0x73,0x74,0x20,0x6c,0x69,0x6b,0x65,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x6f,0x6e,0x65,0x73,0x2e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x61,0x73,0x65,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x74,0x29,0x20,0x3f,0x20,0x49,0x4e,0x54,0x20,0x3a,0x20,0x43,0x48,0x41,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x3b,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x74,0x79,0x70,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4d,0x75,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4d,0x75,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x20,0x2b,0x20,0x50,0x54,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x49,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x3d,0x20,0x4c,0x6f,0x63,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x64,0x65,0x6e,0x74,0x69,0x66,0x69,0x65,0x72,0x20,0x65,0x78,0x69,0x73,0x74,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x64,0x75,0x70,0x6c,0x69,0x63,0x61,0x74,0x65,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x49,0x64,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x74,0x6f,0x72,0x65,0x20,0x74,0x68,0x65,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x42,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x3b,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x20,0x3d,0x20,0x4c,0x6f,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x42,0x54,0x79,0x70,0x65,0x5d,0x20,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x3b,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x20,0x20,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x42,0x56,0x61,0x6c,0x75,0x65,0x5d,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x3b,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x20,0x20,0x3d,0x20,0x2b,0x2b,0x70,0x6f,0x73,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x3b,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,0x6f,0x66,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x2c,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x3b,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x61,0x76,0x65,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,0x73,0x69,0x7a,0x65,0x20,0x66,0x6f,0x72,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0xa,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x45,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,0x6f,0x73,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x2d,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x66,0x5f,0x62,0x70,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x7d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6d,0x69,0x74,0x20,0x63,0x6f,0x64,0x65,0x20,0x66,0x6f,0x72,0x20,0x6c,0x65,0x61,0x76,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x73,0x75,0x62,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x2a,0x2b,0x2b,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x4c,0x45,0x56,0x3b,0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x74,0x79,0x70,0x65,0x20,0x66,0x75,0x6e,0x63,0x5f,0x6e,0x61,0x6d,0x65,0x20,0x28,0x2e,0x2e,0x2e,0x29,0x20,0x7b,0x2e,0x2e,0x2e,0x7d,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7c,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x61,0x72,0x74,0xa,0xa,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x28,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x29,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x7b,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x6f,0x64,0x79,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x7d,0x27,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x75,0x6e,0x77,0x69,0x6e,0x64,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x66,0x6f,0x72,0x20,0x61,0x6c,0x6c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x2e,0xa,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x20,0x3d,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x6f,0x6b,0x65,0x6e,0x5d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x3d,0x20,0x4c,0x6f,0x63,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x42,0x43,0x6c,0x61,0x73,0x73,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x20,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x42,0x54,0x79,0x70,0x65,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x42,0x56,0x61,0x6c,0x75,0x65,0x5d,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x20,0x2b,0x20,0x49,0x64,0x53,0x69,0x7a,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x5f,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x6e,0x74,0x20,0x5b,0x2a,0x5d,0x69,0x64,0x20,0x5b,0x3b,0x20,0x7c,0x20,0x28,0x2e,0x2e,0x2e,0x29,0x20,0x7b,0x2e,0x2e,0x2e,0x7d,0x5d,0xa,0xa,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x79,0x70,0x65,0x3b,0x20,0x2f,0x2f,0x20,0x74,0x6d,0x70,0x2c,0x20,0x61,0x63,0x74,0x75,0x61,0x6c,0x20,0x74,0x79,0x70,0x65,0x20,0x66,0x6f,0x72,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x3b,0x20,0x2f,0x2f,0x20,0x74,0x6d,0x70,0xa,0xa,0x20,0x20,0x20,0x20,0x62,0x61,0x73,0x65,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x65,0x6e,0x75,0x6d,0x2c,0x20,0x74,0x68,0x69,0x73,0x20,0x73,0x68,0x6f,0x75,0x6c,0x64,0x20,0x62,0x65,0x20,0x74,0x72,0x65,0x61,0x74,0x65,0x64,0x20,0x61,0x6c,0x6f,0x6e,0x65,0x2e,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x45,0x6e,0x75,0x6d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x65,0x6e,0x75,0x6d,0x20,0x5b,0x69,0x64,0x5d,0x20,0x7b,0x20,0x61,0x20,0x3d,0x20,0x31,0x30,0x2c,0x20,0x62,0x20,0x3d,0x20,0x32,0x30,0x2c,0x20,0x2e,0x2e,0x2e,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x45,0x6e,0x75,0x6d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x7b,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x49,0x64,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x73,0x6b,0x69,0x70,0x20,0x74,0x68,0x65,0x20,0x5b,0x69,0x64,0x5d,0x20,0x70,0x61,0x72,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x7b,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x74,0x68,0x65,0x20,0x61,0x73,0x73,0x69,0x67,0x6e,0x20,0x70,0x61,0x72,0x74,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x7b,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6e,0x75,0x6d,0x5f,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x7d,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x3b,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x74,0x79,0x70,0x65,0x20,0x69,0x6e,0x66,0x6f,0x72,0x6d,0x61,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x49,0x6e,0x74,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x49,0x6e,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x43,0x68,0x61,0x72,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x43,0x68,0x61,0x72,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x61,0x73,0x65,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x43,0x48,0x41,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6d,0x6d,0x61,0x20,0x73,0x65,0x70,0x65,0x72,0x61,0x74,0x65,0x64,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x2e,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x3b,0x27,0x20,0x26,0x26,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x27,0x7d,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x74,0x79,0x70,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x20,0x74,0x79,0x70,0x65,0x2c,0x20,0x6e,0x6f,0x74,0x65,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x72,0x65,0x20,0x6d,0x61,0x79,0x20,0x65,0x78,0x69,0x73,0x74,0x20,0x60,0x69,0x6e,0x74,0x20,0x2a,0x2a,0x2a,0x2a,0x78,0x3b,0x60,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x4d,0x75,0x6c,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x4d,0x75,0x6c,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x20,0x2b,0x20,0x50,0x54,0x52,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x21,0x3d,0x20,0x49,0x64,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x62,0x61,0x64,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x69,0x64,0x65,0x6e,0x74,0x69,0x66,0x69,0x65,0x72,0x20,0x65,0x78,0x69,0x73,0x74,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3a,0x20,0x64,0x75,0x70,0x6c,0x69,0x63,0x61,0x74,0x65,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x5c,0x6e,0x22,0x2c,0x20,0x6c,0x69,0x6e,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x69,0x74,0x28,0x2d,0x31,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x49,0x64,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x28,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x20,0x46,0x75,0x6e,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x74,0x65,0x78,0x74,0x20,0x2b,0x20,0x31,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x6f,0x66,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x20,0x47,0x6c,0x6f,0x3b,0x20,0x2f,0x2f,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x64,0x61,0x74,0x61,0x3b,0x20,0x2f,0x2f,0x20,0x61,0x73,0x73,0x69,0x67,0x6e,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x61,0x20,0x3d,0x20,0x64,0x61,0x74,0x61,0x20,0x2b,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x28,0x69,0x6e,0x74,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x27,0x2c,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x74,0x63,0x68,0x28,0x27,0x2c,0x27,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x67,0x65,0x74,0x20,0x6e,0x65,0x78,0x74,0x20,0x74,0x6f,0x6b,0x65,0x6e,0xa,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3e,0x20,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x5f,0x64,0x65,0x63,0x6c,0x61,0x72,0x61,0x74,0x69,0x6f,0x6e,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x7d,0xa,0xa,0x69,0x6e,0x74,0x20,0x65,0x76,0x61,0x6c,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6f,0x70,0x2c,0x20,0x2a,0x74,0x6d,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x63,0x79,0x63,0x6c,0x65,0x20,0x3d,0x20,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x31,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x79,0x63,0x6c,0x65,0x20,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x70,0x20,0x3d,0x20,0x2a,0x70,0x63,0x2b,0x2b,0x3b,0x20,0x2f,0x2f,0x20,0x67,0x65,0x74,0x20,0x6e,0x65,0x78,0x74,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x20,0x63,0x6f,0x64,0x65,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x72,0x69,0x6e,0x74,0x20,0x64,0x65,0x62,0x75,0x67,0x20,0x69,0x6e,0x66,0x6f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x64,0x65,0x62,0x75,0x67,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x25,0x64,0x3e,0x20,0x25,0x2e,0x34,0x73,0x22,0x2c,0x20,0x63,0x79,0x63,0x6c,0x65,0x2c,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x26,0x20,0x22,0x4c,0x45,0x41,0x20,0x2c,0x49,0x4d,0x4d,0x20,0x2c,0x4a,0x4d,0x50,0x20,0x2c,0x43,0x41,0x4c,0x4c,0x2c,0x4a,0x5a,0x20,0x20,0x2c,0x4a,0x4e,0x5a,0x20,0x2c,0x45,0x4e,0x54,0x20,0x2c,0x41,0x44,0x4a,0x20,0x2c,0x4c,0x45,0x56,0x20,0x2c,0x4c,0x49,0x20,0x20,0x2c,0x4c,0x43,0x20,0x20,0x2c,0x53,0x49,0x20,0x20,0x2c,0x53,0x43,0x20,0x20,0x2c,0x50,0x55,0x53,0x48,0x2c,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x4f,0x52,0x20,0x20,0x2c,0x58,0x4f,0x52,0x20,0x2c,0x41,0x4e,0x44,0x20,0x2c,0x45,0x51,0x20,0x20,0x2c,0x4e,0x45,0x20,0x20,0x2c,0x4c,0x54,0x20,0x20,0x2c,0x47,0x54,0x20,0x20,0x2c,0x4c,0x45,0x20,0x20,0x2c,0x47,0x45,0x20,0x20,0x2c,0x53,0x48,0x4c,0x20,0x2c,0x53,0x48,0x52,0x20,0x2c,0x41,0x44,0x44,0x20,0x2c,0x53,0x55,0x42,0x20,0x2c,0x4d,0x55,0x4c,0x20,0x2c,0x44,0x49,0x56,0x20,0x2c,0x4d,0x4f,0x44,0x20,0x2c,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x4f,0x50,0x45,0x4e,0x2c,0x52,0x45,0x41,0x44,0x2c,0x43,0x4c,0x4f,0x53,0x2c,0x50,0x52,0x54,0x46,0x2c,0x4d,0x41,0x4c,0x43,0x2c,0x4d,0x53,0x45,0x54,0x2c,0x4d,0x43,0x4d,0x50,0x2c,0x45,0x58,0x49,0x54,0x22,0x5b,0x6f,0x70,0x20,0x2a,0x20,0x35,0x5d,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3c,0x3d,0x20,0x41,0x44,0x4a,0x29,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x20,0x25,0x64,0x5c,0x6e,0x22,0x2c,0x20,0x2a,0x70,0x63,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x49,0x4d,0x4d,0x29,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x61,0x78,0x20,0x3d,0x20,0x2a,0x70,0x63,0x2b,0x2b,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x69,0x6d,0x6d,0x65,0x64,0x69,0x61,0x74,0x65,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x74,0x6f,0x20,0x61,0x78,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4c,0x43,0x29,0x20,0x20,0x20,0x7b,0x61,0x78,0x20,0x3d,0x20,0x2a,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x61,0x78,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x74,0x6f,0x20,0x61,0x78,0x2c,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x69,0x6e,0x20,0x61,0x78,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4c,0x49,0x29,0x20,0x20,0x20,0x7b,0x61,0x78,0x20,0x3d,0x20,0x2a,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x61,0x78,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x20,0x74,0x6f,0x20,0x61,0x78,0x2c,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x69,0x6e,0x20,0x61,0x78,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x53,0x43,0x29,0x20,0x20,0x20,0x7b,0x61,0x78,0x20,0x3d,0x20,0x2a,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x3d,0x20,0x61,0x78,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x61,0x76,0x65,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x74,0x6f,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x2c,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x69,0x6e,0x20,0x61,0x78,0x2c,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x6f,0x6e,0x20,0x73,0x74,0x61,0x63,0x6b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x53,0x49,0x29,0x20,0x20,0x20,0x7b,0x2a,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x3d,0x20,0x61,0x78,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x61,0x76,0x65,0x20,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x20,0x74,0x6f,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x2c,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x69,0x6e,0x20,0x61,0x78,0x2c,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x6f,0x6e,0x20,0x73,0x74,0x61,0x63,0x6b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x50,0x55,0x53,0x48,0x29,0x20,0x7b,0x2a,0x2d,0x2d,0x73,0x70,0x20,0x3d,0x20,0x61,0x78,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x75,0x73,0x68,0x20,0x74,0x68,0x65,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x6f,0x66,0x20,0x61,0x78,0x20,0x6f,0x6e,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x61,0x63,0x6b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4a,0x4d,0x50,0x29,0x20,0x20,0x7b,0x70,0x63,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x2a,0x70,0x63,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6a,0x75,0x6d,0x70,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4a,0x5a,0x29,0x20,0x20,0x20,0x7b,0x70,0x63,0x20,0x3d,0x20,0x61,0x78,0x20,0x3f,0x20,0x70,0x63,0x20,0x2b,0x20,0x31,0x20,0x3a,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x2a,0x70,0x63,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6a,0x75,0x6d,0x70,0x20,0x69,0x66,0x20,0x61,0x78,0x20,0x69,0x73,0x20,0x7a,0x65,0x72,0x6f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4a,0x4e,0x5a,0x29,0x20,0x20,0x7b,0x70,0x63,0x20,0x3d,0x20,0x61,0x78,0x20,0x3f,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x2a,0x70,0x63,0x20,0x3a,0x20,0x70,0x63,0x20,0x2b,0x20,0x31,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6a,0x75,0x6d,0x70,0x20,0x69,0x66,0x20,0x61,0x78,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x7a,0x65,0x72,0x6f,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x43,0x41,0x4c,0x4c,0x29,0x20,0x7b,0x2a,0x2d,0x2d,0x73,0x70,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x70,0x63,0x2b,0x31,0x29,0x3b,0x20,0x70,0x63,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x2a,0x70,0x63,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x63,0x61,0x6c,0x6c,0x20,0x73,0x75,0x62,0x72,0x6f,0x75,0x74,0x69,0x6e,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x52,0x45,0x54,0x29,0x20,0x20,0x7b,0x70,0x63,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x2a,0x73,0x70,0x2b,0x2b,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x72,0x6f,0x6d,0x20,0x73,0x75,0x62,0x72,0x6f,0x75,0x74,0x69,0x6e,0x65,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x45,0x4e,0x54,0x29,0x20,0x20,0x7b,0x2a,0x2d,0x2d,0x73,0x70,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x62,0x70,0x3b,0x20,0x62,0x70,0x20,0x3d,0x20,0x73,0x70,0x3b,0x20,0x73,0x70,0x20,0x3d,0x20,0x73,0x70,0x20,0x2d,0x20,0x2a,0x70,0x63,0x2b,0x2b,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6d,0x61,0x6b,0x65,0x20,0x6e,0x65,0x77,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,0x66,0x72,0x61,0x6d,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x41,0x44,0x4a,0x29,0x20,0x20,0x7b,0x73,0x70,0x20,0x3d,0x20,0x73,0x70,0x20,0x2b,0x20,0x2a,0x70,0x63,0x2b,0x2b,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x64,0x64,0x20,0x65,0x73,0x70,0x2c,0x20,0x3c,0x73,0x69,0x7a,0x65,0x3e,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4c,0x45,0x56,0x29,0x20,0x20,0x7b,0x73,0x70,0x20,0x3d,0x20,0x62,0x70,0x3b,0x20,0x62,0x70,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x2a,0x73,0x70,0x2b,0x2b,0x3b,0x20,0x70,0x63,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x2a,0x73,0x70,0x2b,0x2b,0x3b,0x7d,0x20,0x20,0x2f,0x2f,0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x20,0x63,0x61,0x6c,0x6c,0x20,0x66,0x72,0x61,0x6d,0x65,0x20,0x61,0x6e,0x64,0x20,0x50,0x43,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4c,0x45,0x41,0x29,0x20,0x20,0x7b,0x61,0x78,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x28,0x62,0x70,0x20,0x2b,0x20,0x2a,0x70,0x63,0x2b,0x2b,0x29,0x3b,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x20,0x66,0x6f,0x72,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0x2e,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4f,0x52,0x29,0x20,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x7c,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x58,0x4f,0x52,0x29,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x5e,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x41,0x4e,0x44,0x29,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x26,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x45,0x51,0x29,0x20,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x3d,0x3d,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4e,0x45,0x29,0x20,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x21,0x3d,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4c,0x54,0x29,0x20,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x3c,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4c,0x45,0x29,0x20,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x3c,0x3d,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x47,0x54,0x29,0x20,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x3e,0x20,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x47,0x45,0x29,0x20,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x3e,0x3d,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x53,0x48,0x4c,0x29,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x3c,0x3c,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x53,0x48,0x52,0x29,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x3e,0x3e,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x41,0x44,0x44,0x29,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x2b,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x53,0x55,0x42,0x29,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x2d,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4d,0x55,0x4c,0x29,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x2a,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x44,0x49,0x56,0x29,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x2f,0x20,0x61,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4d,0x4f,0x44,0x29,0x20,0x61,0x78,0x20,0x3d,0x20,0x2a,0x73,0x70,0x2b,0x2b,0x20,0x25,0x20,0x61,0x78,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x45,0x58,0x49,0x54,0x29,0x20,0x7b,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x65,0x78,0x69,0x74,0x28,0x25,0x64,0x29,0x22,0x2c,0x20,0x2a,0x73,0x70,0x29,0x3b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2a,0x73,0x70,0x3b,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4f,0x50,0x45,0x4e,0x29,0x20,0x7b,0x20,0x61,0x78,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x28,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x73,0x70,0x5b,0x31,0x5d,0x2c,0x20,0x73,0x70,0x5b,0x30,0x5d,0x29,0x3b,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x43,0x4c,0x4f,0x53,0x29,0x20,0x7b,0x20,0x61,0x78,0x20,0x3d,0x20,0x63,0x6c,0x6f,0x73,0x65,0x28,0x2a,0x73,0x70,0x29,0x3b,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x52,0x45,0x41,0x44,0x29,0x20,0x7b,0x20,0x61,0x78,0x20,0x3d,0x20,0x72,0x65,0x61,0x64,0x28,0x73,0x70,0x5b,0x32,0x5d,0x2c,0x20,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x73,0x70,0x5b,0x31,0x5d,0x2c,0x20,0x2a,0x73,0x70,0x29,0x3b,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x50,0x52,0x54,0x46,0x29,0x20,0x7b,0x20,0x74,0x6d,0x70,0x20,0x3d,0x20,0x73,0x70,0x20,0x2b,0x20,0x70,0x63,0x5b,0x31,0x5d,0x3b,0x20,0x61,0x78,0x20,0x3d,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x74,0x6d,0x70,0x5b,0x2d,0x31,0x5d,0x2c,0x20,0x74,0x6d,0x70,0x5b,0x2d,0x32,0x5d,0x2c,0x20,0x74,0x6d,0x70,0x5b,0x2d,0x33,0x5d,0x2c,0x20,0x74,0x6d,0x70,0x5b,0x2d,0x34,0x5d,0x2c,0x20,0x74,0x6d,0x70,0x5b,0x2d,0x35,0x5d,0x2c,0x20,0x74,0x6d,0x70,0x5b,0x2d,0x36,0x5d,0x29,0x3b,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4d,0x41,0x4c,0x43,0x29,0x20,0x7b,0x20,0x61,0x78,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x2a,0x73,0x70,0x29,0x3b,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4d,0x53,0x45,0x54,0x29,0x20,0x7b,0x20,0x61,0x78,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x73,0x70,0x5b,0x32,0x5d,0x2c,0x20,0x73,0x70,0x5b,0x31,0x5d,0x2c,0x20,0x2a,0x73,0x70,0x29,0x3b,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x4d,0x43,0x4d,0x50,0x29,0x20,0x7b,0x20,0x61,0x78,0x20,0x3d,0x20,0x6d,0x65,0x6d,0x63,0x6d,0x70,0x28,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x73,0x70,0x5b,0x32,0x5d,0x2c,0x20,0x28,0x63,0x68,0x61,0x72,0x20,0x2a,0x29,0x73,0x70,0x5b,0x31,0x5d,0x2c,0x20,0x2a,0x73,0x70,0x29,0x3b,0x7d,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x69,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x25,0x64,0x5c,0x6e,0x22,0x2c,0x20,0x6f,0x70,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x7d,0xa,0xa,0x23,0x75,0x6e,0x64,0x65,0x66,0x20,0x69,0x6e,0x74,0x20,0x2f,0x2f,0x20,0x4d,0x61,0x63,0x2f,0x63,0x6c,0x61,0x6e,0x67,0x20,0x6e,0x65,0x65,0x64,0x73,0x20,0x74,0x68,0x69,0x73,0x20,0x74,0x6f,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0xa,0xa,0x69,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x69,0x6e,0x74,0x20,0x61,0x72,0x67,0x63,0x2c,0x20,0x63,0x68,0x61,0x72,0x20,0x2a,0x2a,0x61,0x72,0x67,0x76,0x29,0xa,0x7b,0xa,0x20,0x20,0x20,0x20,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x6c,0x6f,0x6e,0x67,0x20,0x2f,0x2f,0x20,0x74,0x6f,0x20,0x77,0x6f,0x72,0x6b,0x20,0x77,0x69,0x74,0x68,0x20,0x36,0x34,0x62,0x69,0x74,0x20,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0xa,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x2c,0x20,0x66,0x64,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x2a,0x74,0x6d,0x70,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x63,0x2d,0x2d,0x3b,0xa,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x76,0x2b,0x2b,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x70,0x61,0x72,0x73,0x65,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x72,0x67,0x63,0x20,0x3e,0x20,0x30,0x20,0x26,0x26,0x20,0x2a,0x2a,0x61,0x72,0x67,0x76,0x20,0x3d,0x3d,0x20,0x27,0x2d,0x27,0x20,0x26,0x26,0x20,0x28,0x2a,0x61,0x72,0x67,0x76,0x29,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x73,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x79,0x20,0x3d,0x20,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2d,0x2d,0x61,0x72,0x67,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x2b,0x61,0x72,0x67,0x76,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x72,0x67,0x63,0x20,0x3e,0x20,0x30,0x20,0x26,0x26,0x20,0x2a,0x2a,0x61,0x72,0x67,0x76,0x20,0x3d,0x3d,0x20,0x27,0x2d,0x27,0x20,0x26,0x26,0x20,0x28,0x2a,0x61,0x72,0x67,0x76,0x29,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x64,0x27,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x65,0x62,0x75,0x67,0x20,0x3d,0x20,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2d,0x2d,0x61,0x72,0x67,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x2b,0x61,0x72,0x67,0x76,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x72,0x67,0x63,0x20,0x3c,0x20,0x31,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x75,0x73,0x61,0x67,0x65,0x3a,0x20,0x78,0x63,0x20,0x5b,0x2d,0x73,0x5d,0x20,0x5b,0x2d,0x64,0x5d,0x20,0x66,0x69,0x6c,0x65,0x20,0x2e,0x2e,0x2e,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x66,0x64,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x28,0x2a,0x61,0x72,0x67,0x76,0x2c,0x20,0x30,0x29,0x29,0x20,0x3c,0x20,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x63,0x6f,0x75,0x6c,0x64,0x20,0x6e,0x6f,0x74,0x20,0x6f,0x70,0x65,0x6e,0x28,0x25,0x73,0x29,0x5c,0x6e,0x22,0x2c,0x20,0x2a,0x61,0x72,0x67,0x76,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x32,0x35,0x36,0x20,0x2a,0x20,0x31,0x30,0x32,0x34,0x3b,0x20,0x2f,0x2f,0x20,0x61,0x72,0x62,0x69,0x74,0x72,0x61,0x72,0x79,0x20,0x73,0x69,0x7a,0x65,0xa,0x20,0x20,0x20,0x20,0x6c,0x69,0x6e,0x65,0x20,0x3d,0x20,0x31,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x65,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x63,0x6f,0x75,0x6c,0x64,0x20,0x6e,0x6f,0x74,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x25,0x64,0x29,0x20,0x66,0x6f,0x72,0x20,0x74,0x65,0x78,0x74,0x20,0x61,0x72,0x65,0x61,0x5c,0x6e,0x22,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x64,0x61,0x74,0x61,0x20,0x3d,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x63,0x6f,0x75,0x6c,0x64,0x20,0x6e,0x6f,0x74,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x25,0x64,0x29,0x20,0x66,0x6f,0x72,0x20,0x64,0x61,0x74,0x61,0x20,0x61,0x72,0x65,0x61,0x5c,0x6e,0x22,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x73,0x74,0x61,0x63,0x6b,0x20,0x3d,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x63,0x6f,0x75,0x6c,0x64,0x20,0x6e,0x6f,0x74,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x25,0x64,0x29,0x20,0x66,0x6f,0x72,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,0x61,0x72,0x65,0x61,0x5c,0x6e,0x22,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x20,0x3d,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x63,0x6f,0x75,0x6c,0x64,0x20,0x6e,0x6f,0x74,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x25,0x64,0x29,0x20,0x66,0x6f,0x72,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x74,0x61,0x62,0x6c,0x65,0x5c,0x6e,0x22,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,0x74,0x65,0x78,0x74,0x2c,0x20,0x30,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,0x64,0x61,0x74,0x61,0x2c,0x20,0x30,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,0x73,0x74,0x61,0x63,0x6b,0x2c,0x20,0x30,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x6d,0x65,0x6d,0x73,0x65,0x74,0x28,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x2c,0x20,0x30,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x6f,0x6c,0x64,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,0x3d,0x20,0x22,0x63,0x68,0x61,0x72,0x20,0x65,0x6c,0x73,0x65,0x20,0x65,0x6e,0x75,0x6d,0x20,0x69,0x66,0x20,0x69,0x6e,0x74,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x6f,0x66,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x22,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6f,0x70,0x65,0x6e,0x20,0x72,0x65,0x61,0x64,0x20,0x63,0x6c,0x6f,0x73,0x65,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x20,0x6d,0x65,0x6d,0x73,0x65,0x74,0x20,0x6d,0x65,0x6d,0x63,0x6d,0x70,0x20,0x65,0x78,0x69,0x74,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x22,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x64,0x64,0x20,0x6b,0x65,0x79,0x77,0x6f,0x72,0x64,0x73,0x20,0x74,0x6f,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x74,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x43,0x68,0x61,0x72,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x69,0x20,0x3c,0x3d,0x20,0x57,0x68,0x69,0x6c,0x65,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x6f,0x6b,0x65,0x6e,0x5d,0x20,0x3d,0x20,0x69,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x61,0x64,0x64,0x20,0x6c,0x69,0x62,0x72,0x61,0x72,0x79,0x20,0x74,0x6f,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x74,0x61,0x62,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x4f,0x50,0x45,0x4e,0x3b,0xa,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x69,0x20,0x3c,0x3d,0x20,0x45,0x58,0x49,0x54,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x43,0x6c,0x61,0x73,0x73,0x5d,0x20,0x3d,0x20,0x53,0x79,0x73,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x79,0x70,0x65,0x5d,0x20,0x3d,0x20,0x49,0x4e,0x54,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x20,0x3d,0x20,0x69,0x2b,0x2b,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x5b,0x54,0x6f,0x6b,0x65,0x6e,0x5d,0x20,0x3d,0x20,0x43,0x68,0x61,0x72,0x3b,0x20,0x2f,0x2f,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x20,0x76,0x6f,0x69,0x64,0x20,0x74,0x79,0x70,0x65,0xa,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x28,0x29,0x3b,0x20,0x69,0x64,0x6d,0x61,0x69,0x6e,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x69,0x64,0x3b,0x20,0x2f,0x2f,0x20,0x6b,0x65,0x65,0x70,0x20,0x74,0x72,0x61,0x63,0x6b,0x20,0x6f,0x66,0x20,0x6d,0x61,0x69,0x6e,0xa,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x73,0x72,0x63,0x20,0x3d,0x20,0x6f,0x6c,0x64,0x5f,0x73,0x72,0x63,0x20,0x3d,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x63,0x6f,0x75,0x6c,0x64,0x20,0x6e,0x6f,0x74,0x20,0x6d,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x25,0x64,0x29,0x20,0x66,0x6f,0x72,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x61,0x72,0x65,0x61,0x5c,0x6e,0x22,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x72,0x65,0x61,0x64,0x20,0x74,0x68,0x65,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x66,0x69,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x69,0x20,0x3d,0x20,0x72,0x65,0x61,0x64,0x28,0x66,0x64,0x2c,0x20,0x73,0x72,0x63,0x2c,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x2d,0x31,0x29,0x29,0x20,0x3c,0x3d,0x20,0x30,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x72,0x65,0x61,0x64,0x28,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x65,0x64,0x20,0x25,0x64,0x5c,0x6e,0x22,0x2c,0x20,0x69,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x30,0x3b,0x20,0x2f,0x2f,0x20,0x61,0x64,0x64,0x20,0x45,0x4f,0x46,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0xa,0x20,0x20,0x20,0x20,0x63,0x6c,0x6f,0x73,0x65,0x28,0x66,0x64,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x70,0x72,0x6f,0x67,0x72,0x61,0x6d,0x28,0x29,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x70,0x63,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x69,0x64,0x6d,0x61,0x69,0x6e,0x5b,0x56,0x61,0x6c,0x75,0x65,0x5d,0x29,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x66,0x28,0x22,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x6e,0x6f,0x74,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x5c,0x6e,0x22,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x64,0x75,0x6d,0x70,0x5f,0x74,0x65,0x78,0x74,0x28,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x79,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x66,0x6f,0x72,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x3b,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x65,0x74,0x75,0x70,0x20,0x73,0x74,0x61,0x63,0x6b,0xa,0x20,0x20,0x20,0x20,0x73,0x70,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x20,0x2a,0x29,0x28,0x28,0x69,0x6e,0x74,0x29,0x73,0x74,0x61,0x63,0x6b,0x20,0x2b,0x20,0x70,0x6f,0x6f,0x6c,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x2a,0x2d,0x2d,0x73,0x70,0x20,0x3d,0x20,0x45,0x58,0x49,0x54,0x3b,0x20,0x2f,0x2f,0x20,0x63,0x61,0x6c,0x6c,0x20,0x65,0x78,0x69,0x74,0x20,0x69,0x66,0x20,0x6d,0x61,0x69,0x6e,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x73,0xa,0x20,0x20,0x20,0x20,0x2a,0x2d,0x2d,0x73,0x70,0x20,0x3d,0x20,0x50,0x55,0x53,0x48,0x3b,0x20,0x74,0x6d,0x70,0x20,0x3d,0x20,0x73,0x70,0x3b,0xa,0x20,0x20,0x20,0x20,0x2a,0x2d,0x2d,0x73,0x70,0x20,0x3d,0x20,0x61,0x72,0x67,0x63,0x3b,0xa,0x20,0x20,0x20,0x20,0x2a,0x2d,0x2d,0x73,0x70,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x61,0x72,0x67,0x76,0x3b,0xa,0x20,0x20,0x20,0x20,0x2a,0x2d,0x2d,0x73,0x70,0x20,0x3d,0x20,0x28,0x69,0x6e,0x74,0x29,0x74,0x6d,0x70,0x3b,0xa,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x65,0x76,0x61,0x6c,0x28,0x29,0x3b,0xa,0x7d,0xa};
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "consttypes.h"
 #include "functions.h"
+#include "search.h"
 
 #include "test0-txt.h"
 MFILE __infile = {
@@ -86,6 +87,36 @@ main(int argc, char *argv[])
 	}
 			
 	for (int i=0; i<repititions; i++) {
+#ifdef ALPHABETA
+		// search the move with the iterative-deepening alpha-beta engine
+		move_info_t choice_move;
+		if (!ab_choose_move(*board, black_action, choice_move)) {
+			// no possible moves, indicating game over
+#ifdef AB_STATS
+			ab_print_stats();
+#endif
+			if (black_action) {
+				libmin_printf("%s WIN!\n", WHITE);
+				libmin_success();
+			}
+			else {
+				libmin_printf("%s WIN!\n", BLACK);
+				libmin_success();
+			}
+		}
+
+		change_board(board, choice_move[0][0], choice_move[0][1],
+			choice_move[1][0], choice_move[1][1]);
+
+		print_move_information(1, black_action, *board, 
+			choice_move[0][0], choice_move[0][1], 
+			choice_move[1][0], choice_move[1][1], action);
+
+		print_board(board);
+
+		black_action = !black_action;
+		action += 1;
+#else /* !ALPHABETA */
 		// stage 1
 			// create the level 0 node first, and fill with relevent info.
 		tree_node_t* level_0_node = (tree_node_t*)libmin_malloc(sizeof(tree_node_t));
@@ -148,7 +179,11 @@ main(int argc, char *argv[])
 		
 		free_tree(level_0_node); // free space occupied by the tree
 			// no need for it anymore
+#endif /* ALPHABETA */
 	}
+#if defined(ALPHABETA) && defined(AB_STATS)
+	ab_print_stats();
+#endif
 	
 	libmin_free(board);
   libmin_success(); // exit program with the success code
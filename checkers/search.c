@@ -0,0 +1,284 @@
+#include "libmin.h"
+
+#include "consttypes.h"
+#include "functions.h"
+#include "search.h"
+
+// iterative-deepening negamax with alpha-beta pruning, a transposition
+// table, and killer-move and history heuristics for move ordering
+// scores are board costs from the view of the side to move, a side
+// without moves scores -AB_INF, as in move_score_forced()
+
+#define AB_INF          INT_MAX
+#define TT_SIZE         (1 << TT_BITS)
+#define TT_EXACT        0
+#define TT_LOWER        1
+#define TT_UPPER        2
+#define NO_MOVE         (-1)
+
+// moves are encoded as source square * 64 + target square,
+// squares as (col - 1) * 8 + (row - 1)
+#define MOVE_SRC(m)     ((m) >> 6)
+#define MOVE_DST(m)     ((m) & 63)
+
+typedef struct {
+	uint64_t key;
+	int score;
+	short move;
+	char depth;
+	char flag;
+} tt_entry_t;
+
+static tt_entry_t tt[TT_SIZE];
+static uint64_t zobrist[BOARD_SIZE * BOARD_SIZE][4]; // b, w, B, W
+static uint64_t zobrist_black; // black to move
+static int tables_ready = 0;
+
+static int killers[MAX_PLY][2];
+static int history[BOARD_SIZE * BOARD_SIZE][BOARD_SIZE * BOARD_SIZE];
+
+static long nodes, move_nodes, tt_probes, tt_hits, tt_cutoffs;
+static int aborted, budgeted; // budgeted: the node budget applies
+
+// xorshift generator for the Zobrist keys
+static uint64_t rand64(void) {
+	static uint64_t x = 0x9e3779b97f4a7c15ULL;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	return x;
+}
+
+static void init_tables(void) {
+	for (int i=0; i<BOARD_SIZE * BOARD_SIZE; i++) {
+		for (int k=0; k<4; k++) {
+			zobrist[i][k] = rand64();
+		}
+	}
+	zobrist_black = rand64();
+	tables_ready = 1;
+}
+
+static int piece_index(char checker) {
+	if (checker == CELL_BPIECE) return 0;
+	if (checker == CELL_WPIECE) return 1;
+	if (checker == CELL_BTOWER) return 2;
+	return 3;
+}
+
+static uint64_t hash_board(board_t board_input, int black_action) {
+	uint64_t key = black_action ? zobrist_black : 0;
+	for (int i=0; i<BOARD_SIZE; i++) {
+		for (int j=0; j<BOARD_SIZE; j++) {
+			if (board_input[i][j] != CELL_EMPTY) {
+				key ^= zobrist[i * BOARD_SIZE + j][piece_index(board_input[i][j])];
+			}
+		}
+	}
+	return key;
+}
+
+// generate all moves of the side with action, in the same order as
+// generate_node_children(), returns the number of moves
+static int generate_moves(board_t board_input, int black_action, int *moves) {
+	int count = 0;
+	for (int j=0; j<BOARD_SIZE; j++) {
+		for (int i=0; i<BOARD_SIZE; i++) {
+			if (movable_checker(black_action, board_input[i][j])) {
+				static valid_moves_t valid_moves;
+				int num_possibles = all_possible_moves(board_input,
+					col_to_char(i+1), row_to_char(j+1), valid_moves, black_action);
+				for (int k=0; k<num_possibles; k++) {
+					int dst = (char_to_col(valid_moves[k][0]) - 1) * BOARD_SIZE
+						+ char_to_row(valid_moves[k][1]) - 1;
+					moves[count++] = ((i * BOARD_SIZE + j) << 6) | dst;
+				}
+			}
+		}
+	}
+	return count;
+}
+
+static void make_move(board_t board_input, int move, board_t child) {
+	libmin_memcpy(child, board_input, sizeof(board_t));
+	change_board((board_t*)child,
+		col_to_char(MOVE_SRC(move) / BOARD_SIZE + 1),
+		row_to_char(MOVE_SRC(move) % BOARD_SIZE + 1),
+		col_to_char(MOVE_DST(move) / BOARD_SIZE + 1),
+		row_to_char(MOVE_DST(move) % BOARD_SIZE + 1));
+}
+
+// order moves by transposition table move, killers, then history score
+// insertion sort is stable, so ties keep the generation order
+static void order_moves(int *moves, int count, int tt_move, int ply) {
+	int keys[MAX_MOVES];
+	for (int i=0; i<count; i++) {
+		int m = moves[i];
+		if (m == tt_move) {
+			keys[i] = AB_INF;
+		}
+		else if (m == killers[ply][0]) {
+			keys[i] = AB_INF - 1;
+		}
+		else if (m == killers[ply][1]) {
+			keys[i] = AB_INF - 2;
+		}
+		else {
+			keys[i] = history[MOVE_SRC(m)][MOVE_DST(m)];
+		}
+	}
+	for (int i=1; i<count; i++) {
+		int m = moves[i], k = keys[i], j = i - 1;
+		while (j >= 0 && keys[j] < k) {
+			moves[j + 1] = moves[j];
+			keys[j + 1] = keys[j];
+			j--;
+		}
+		moves[j + 1] = m;
+		keys[j + 1] = k;
+	}
+}
+
+static int negamax(board_t board_input, int black_action, int depth, int ply,
+	int alpha, int beta) {
+	nodes++;
+	move_nodes++;
+	if (NODE_BUDGET && budgeted && move_nodes > NODE_BUDGET) {
+		aborted = 1;
+		return 0;
+	}
+	if (depth == 0) {
+		int cost = board_cost(board_input);
+		return black_action ? cost : -cost;
+	}
+
+	// probe the transposition table
+	uint64_t key = hash_board(board_input, black_action);
+	tt_entry_t *entry = &tt[key & (TT_SIZE - 1)];
+	int tt_move = NO_MOVE;
+	tt_probes++;
+	if (entry->key == key) {
+		tt_hits++;
+		tt_move = entry->move;
+		if (entry->depth >= depth) {
+			if ((entry->flag == TT_EXACT)
+				|| (entry->flag == TT_LOWER && entry->score >= beta)
+				|| (entry->flag == TT_UPPER && entry->score <= alpha)) {
+				tt_cutoffs++;
+				return entry->score;
+			}
+		}
+	}
+
+	int moves[MAX_MOVES];
+	int count = generate_moves(board_input, black_action, moves);
+	if (count == 0) {
+		return -AB_INF; // no possible moves, game over
+	}
+	order_moves(moves, count, tt_move, ply);
+
+	int alpha_orig = alpha, best_score = -AB_INF, best_move = moves[0];
+	for (int i=0; i<count; i++) {
+		board_t child;
+		make_move(board_input, moves[i], child);
+		int score = -negamax(child, !black_action, depth - 1, ply + 1,
+			-beta, -alpha);
+		if (aborted) {
+			return 0;
+		}
+		if (score > best_score) {
+			best_score = score;
+			best_move = moves[i];
+		}
+		if (best_score > alpha) {
+			alpha = best_score;
+		}
+		if (alpha >= beta) {
+			// remember the quiet refutation for siblings, and in the history
+			if (killers[ply][0] != moves[i]) {
+				killers[ply][1] = killers[ply][0];
+				killers[ply][0] = moves[i];
+			}
+			history[MOVE_SRC(moves[i])][MOVE_DST(moves[i])] += depth * depth;
+			break;
+		}
+	}
+
+	entry->key = key;
+	entry->score = best_score;
+	entry->move = best_move;
+	entry->depth = depth;
+	if (best_score <= alpha_orig) {
+		entry->flag = TT_UPPER;
+	}
+	else if (best_score >= beta) {
+		entry->flag = TT_LOWER;
+	}
+	else {
+		entry->flag = TT_EXACT;
+	}
+	return best_score;
+}
+
+// search the root to the given depth, root moves are searched in generation
+// order, and the first move with the best score is chosen, as in main()
+static int search_root(board_t board_input, int black_action, int depth,
+	int *moves, int count) {
+	int alpha = -AB_INF, best_move = NO_MOVE;
+	for (int i=0; i<count; i++) {
+		board_t child;
+		make_move(board_input, moves[i], child);
+		int score = -negamax(child, !black_action, depth - 1, 1, -AB_INF, -alpha);
+		if (aborted) {
+			return NO_MOVE;
+		}
+		if (score > alpha || best_move == NO_MOVE) {
+			alpha = score;
+			best_move = moves[i];
+		}
+	}
+	return best_move;
+}
+
+// choose the move of the side with action with iterative deepening up to
+// AB_DEPTH, within NODE_BUDGET nodes if set (the depth 1 iteration is
+// exempt from the budget, so it always completes), returns 0 if there are no
+// possible moves
+int ab_choose_move(board_t board_input, int black_action,
+	move_info_t best_move) {
+	if (!tables_ready) {
+		init_tables();
+	}
+
+	int moves[MAX_MOVES];
+	int count = generate_moves(board_input, black_action, moves);
+	if (count == 0) {
+		return 0;
+	}
+
+	int move = moves[0];
+	move_nodes = 0;
+	for (int depth=1; depth<=AB_DEPTH; depth++) {
+		aborted = 0;
+		budgeted = depth > 1;
+		int m = search_root(board_input, black_action, depth, moves, count);
+		if (aborted) {
+			break; // out of budget, keep the last complete iteration
+		}
+		if (m != NO_MOVE) {
+			move = m;
+		}
+	}
+	aborted = 0;
+
+	best_move[0][0] = col_to_char(MOVE_SRC(move) / BOARD_SIZE + 1);
+	best_move[0][1] = row_to_char(MOVE_SRC(move) % BOARD_SIZE + 1);
+	best_move[1][0] = col_to_char(MOVE_DST(move) / BOARD_SIZE + 1);
+	best_move[1][1] = row_to_char(MOVE_DST(move) % BOARD_SIZE + 1);
+	return count;
+}
+
+void ab_print_stats(void) {
+	libmin_printf("SEARCH: %ld nodes, %ld TT probes, %ld hits, %ld cutoffs\n",
+		nodes, tt_probes, tt_hits, tt_cutoffs);
+}
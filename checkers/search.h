@@ -0,0 +1,27 @@
+#include "libmin.h"
+
+#ifndef SEARCH_H
+#define SEARCH_H
+
+// iterative-deepening alpha-beta engine, an alternative to the minimax tree
+// of functions.c, selected by defining ALPHABETA
+// with the default parameters it makes the same moves as the tree
+
+#ifndef AB_DEPTH
+#define AB_DEPTH        TREE_DEPTH  // maximum search depth
+#endif
+#ifndef NODE_BUDGET
+#define NODE_BUDGET     0           // nodes per move, 0 is unlimited
+#endif
+#ifndef TT_BITS
+#define TT_BITS         16          // log2 of transposition table entries
+#endif
+
+#define MAX_MOVES       48          // 12 checkers with 4 moves each
+#define MAX_PLY         64
+
+int ab_choose_move(board_t board_input, int black_action,
+	move_info_t best_move);
+void ab_print_stats(void);
+
+#endif
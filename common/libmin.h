@@ -12,6 +12,7 @@
    #define LIBMIN_HOST		- build to run on Unix host
    #define LIBMIN_TARGET		- build to run on ARM target model
    #define LIBMIN_MALLOC_ALIGN_BYTES  - minimum allignment of malloc'd regions (optional)
+   #define LIBMIN_MALLOC_STATS	- collect heap statistics, reported at libmin_success() (optional)
 
 */
 
@@ -110,6 +111,69 @@ void *libmin_realloc(void *block, size_t size);
 /* free memory */
 void libmin_free(void * addr);
 
+#ifdef LIBMIN_MALLOC_STATS
+/* print heap usage statistics */
+void libmin_malloc_report(void);
+#endif /* LIBMIN_MALLOC_STATS */
+
+/* arena (bump) allocator, for phase-structured allocation */
+typedef struct {
+  uint8_t *base;	/* arena storage */
+  size_t size;		/* size of arena storage, in bytes */
+  size_t used;		/* bytes allocated, including alignment padding */
+  int sbrked;		/* storage came from libtarg_sbrk() */
+} libmin_arena_t;
+
+/* default alignment of arena allocations */
+#ifndef LIBMIN_ARENA_ALIGN_BYTES
+#define LIBMIN_ARENA_ALIGN_BYTES  8
+#endif /* LIBMIN_ARENA_ALIGN_BYTES */
+
+/* initialize an arena over a fixed buffer */
+void libmin_arena_init(libmin_arena_t *arena, void *buf, size_t size);
+
+/* initialize an arena with storage from the target heap, returns FALSE on failure */
+int libmin_arena_create(libmin_arena_t *arena, size_t size);
+
+/* allocate from an arena, returns NULL if the arena is exhausted */
+void *libmin_arena_alloc(libmin_arena_t *arena, size_t size);
+void *libmin_arena_alloc_aligned(libmin_arena_t *arena, size_t size, size_t align);
+
+/* release all arena allocations, in O(1) */
+void libmin_arena_reset(libmin_arena_t *arena);
+
+/* release an arena and its storage, in O(1) */
+void libmin_arena_destroy(libmin_arena_t *arena);
+
+/* fixed-size object pool allocator, for linked data structures */
+typedef struct {
+  uint8_t *slab;	/* pool storage, as returned by libtarg_sbrk() */
+  size_t slab_size;	/* size of pool storage, in bytes */
+  uint8_t *base;	/* first (aligned) object in the slab */
+  size_t obj_size;	/* object size, rounded up to alignment */
+  size_t capacity;	/* number of objects in the slab */
+  size_t carved;	/* objects handed out from the slab so far */
+  void *free_list;	/* freed objects, linked through their first word */
+  size_t live;		/* objects currently allocated */
+} libmin_pool_t;
+
+/* alignment of pool objects */
+#ifndef LIBMIN_POOL_ALIGN_BYTES
+#define LIBMIN_POOL_ALIGN_BYTES  8
+#endif /* LIBMIN_POOL_ALIGN_BYTES */
+
+/* initialize a pool of CAPACITY objects of OBJ_SIZE bytes, returns FALSE on failure */
+int libmin_pool_init(libmin_pool_t *pool, size_t obj_size, size_t capacity);
+
+/* allocate a pool object, returns NULL if the pool is exhausted */
+void *libmin_pool_alloc(libmin_pool_t *pool);
+
+/* return an object to its pool */
+void libmin_pool_free(libmin_pool_t *pool, void *obj);
+
+/* release a pool and its storage */
+void libmin_pool_destroy(libmin_pool_t *pool);
+
 #ifndef __clang__
 #define NULL	((void *)0)
 #endif
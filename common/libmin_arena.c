@@ -0,0 +1,70 @@
+#include "libmin.h"
+#include "libtarg.h"
+
+/* arena (bump) allocator, allocations are released all at once with a
+   reset or destroy, there is no per-allocation header or free */
+
+/* initialize ARENA to allocate from the caller-supplied buffer BUF of SIZE bytes */
+void
+libmin_arena_init(libmin_arena_t *arena, void *buf, size_t size)
+{
+  arena->base = (uint8_t *)buf;
+  arena->size = size;
+  arena->used = 0;
+  arena->sbrked = FALSE;
+}
+
+/* initialize ARENA with SIZE bytes from the target heap, returns FALSE if out of memory */
+int
+libmin_arena_create(libmin_arena_t *arena, size_t size)
+{
+  void *buf = libtarg_sbrk(size);
+
+  if (buf == (void *)-1)
+  {
+    libmin_arena_init(arena, NULL, 0);
+    return FALSE;
+  }
+  libmin_arena_init(arena, buf, size);
+  arena->sbrked = TRUE;
+  return TRUE;
+}
+
+/* allocate SIZE bytes from ARENA aligned to ALIGN bytes (a power of two),
+   returns NULL if the arena is exhausted */
+void *
+libmin_arena_alloc_aligned(libmin_arena_t *arena, size_t size, size_t align)
+{
+  uintptr_t ptr = (uintptr_t)(arena->base + arena->used);
+  size_t pad = (size_t)(-ptr & (align - 1));
+
+  if (size + pad > arena->size - arena->used)
+    return NULL;
+
+  arena->used += pad + size;
+  return (void *)(ptr + pad);
+}
+
+/* allocate SIZE bytes from ARENA with the default alignment */
+void *
+libmin_arena_alloc(libmin_arena_t *arena, size_t size)
+{
+  return libmin_arena_alloc_aligned(arena, size, LIBMIN_ARENA_ALIGN_BYTES);
+}
+
+/* release all allocations in ARENA, the arena can then be reused */
+void
+libmin_arena_reset(libmin_arena_t *arena)
+{
+  arena->used = 0;
+}
+
+/* release ARENA, heap storage is returned to the target if the arena is
+   still at the top of the heap, otherwise it is abandoned */
+void
+libmin_arena_destroy(libmin_arena_t *arena)
+{
+  if (arena->sbrked && arena->base + arena->size == (uint8_t *)libtarg_sbrk(0))
+    libtarg_sbrk(0 - arena->size);
+  libmin_arena_init(arena, NULL, 0);
+}
@@ -39,6 +39,90 @@ typedef union memhdr memhdr_t;
 
 static memhdr_t *head = NULL, *tail = NULL;
 
+#ifdef LIBMIN_MALLOC_STATS
+/* optional heap instrumentation, enable with -DLIBMIN_MALLOC_STATS */
+
+/* size classes are powers of two, from <=16 bytes up to >(16 << (N-2)) bytes */
+#define STATS_NCLASSES  12
+
+/* maximum number of distinct call sites tracked */
+#define STATS_NSITES    32
+
+struct site_stats {
+  void *site;
+  size_t allocs;
+  size_t bytes;
+};
+
+static struct {
+  size_t mallocs, callocs, reallocs, frees;
+  size_t failed;
+  size_t reused;
+  size_t req_bytes;
+  size_t live_bytes, peak_live_bytes;
+  size_t heap_bytes, peak_heap_bytes;
+  size_t class_count[STATS_NCLASSES];
+  size_t class_bytes[STATS_NCLASSES];
+  struct site_stats sites[STATS_NSITES];
+  size_t dropped_sites;
+} __stats;
+
+static int
+__stats_class(size_t size)
+{
+  int cls = 0;
+  size_t limit = 16;
+
+  while (size > limit && cls < STATS_NCLASSES-1)
+  {
+    limit <<= 1;
+    cls++;
+  }
+  return cls;
+}
+
+static void
+__stats_alloc(void *site, size_t size)
+{
+  int cls = __stats_class(size);
+  __stats.class_count[cls]++;
+  __stats.class_bytes[cls] += size;
+  __stats.req_bytes += size;
+
+  for (int i=0; i < STATS_NSITES; i++)
+  {
+    if (__stats.sites[i].site == site || __stats.sites[i].site == NULL)
+    {
+      __stats.sites[i].site = site;
+      __stats.sites[i].allocs++;
+      __stats.sites[i].bytes += size;
+      return;
+    }
+  }
+  __stats.dropped_sites++;
+}
+
+static void
+__stats_live(size_t inc, size_t dec)
+{
+  __stats.live_bytes = __stats.live_bytes + inc - dec;
+  if (__stats.live_bytes > __stats.peak_live_bytes)
+    __stats.peak_live_bytes = __stats.live_bytes;
+}
+
+static void
+__stats_heap(size_t inc, size_t dec)
+{
+  __stats.heap_bytes = __stats.heap_bytes + inc - dec;
+  if (__stats.heap_bytes > __stats.peak_heap_bytes)
+    __stats.peak_heap_bytes = __stats.heap_bytes;
+}
+
+#define STATS(X)  X
+#else /* !LIBMIN_MALLOC_STATS */
+#define STATS(X)
+#endif /* LIBMIN_MALLOC_STATS */
+
 static memhdr_t *
 __get_free_block(size_t size) {
 	memhdr_t *current = head;
@@ -51,8 +135,8 @@ __get_free_block(size_t size) {
 	return NULL;
 }
 
-void *
-libmin_malloc(size_t size) {
+static void *
+__malloc(size_t size) {
 	void *block;
 	memhdr_t *header;
 
@@ -75,6 +159,8 @@ libmin_malloc(size_t size) {
 
 	if (header) {
 		header->is_free = 0;
+		STATS(__stats.reused++);
+		STATS(__stats_live(header->size, 0));
 		return (void *) (header + 1);
 	}
 	size_t total_size = sizeof(memhdr_t) + size;
@@ -82,6 +168,8 @@ libmin_malloc(size_t size) {
 	if (block == (void *) -1) {
 		return NULL;
 	}
+	STATS(__stats_heap(total_size, 0));
+	STATS(__stats_live(size, 0));
 
 	header = block;
 	header->size = size;
@@ -98,6 +186,15 @@ libmin_malloc(size_t size) {
 	return (void *) (header + 1);
 }
 
+void *
+libmin_malloc(size_t size) {
+	void *block = __malloc(size);
+
+	STATS(__stats.mallocs++);
+	STATS(if (block) __stats_alloc(__builtin_return_address(0), size); else __stats.failed++);
+	return block;
+}
+
 void
 libmin_free(void *block) {
 	memhdr_t *header;
@@ -107,6 +204,8 @@ libmin_free(void *block) {
 	}
 
 	header = (memhdr_t * )block - 1;
+	STATS(__stats.frees++);
+	STATS(__stats_live(0, header->size));
 
 	void *pbreak = libtarg_sbrk(0);
 	memhdr_t *tmp;
@@ -123,6 +222,8 @@ libmin_free(void *block) {
 				tmp = tmp->next;
 			}
 		}
+		/* header is no longer accessible after the break is lowered */
+		STATS(__stats_heap(0, sizeof(memhdr_t) + header->size));
 		libtarg_sbrk(0 - sizeof(memhdr_t) - header->size);
 		return;
 	}
@@ -140,7 +241,9 @@ libmin_calloc(size_t num, size_t nsize) {
 	if (nsize != size / num) {
 		return NULL; // If ml
 	}
-	void *block = libmin_malloc(size);
+	void *block = __malloc(size);
+	STATS(__stats.callocs++);
+	STATS(if (block) __stats_alloc(__builtin_return_address(0), size); else __stats.failed++);
 	if (!block) {
 		return NULL;
 	}
@@ -151,8 +254,11 @@ libmin_calloc(size_t num, size_t nsize) {
 void *
 libmin_realloc(void *block, size_t size)
 {
+	STATS(__stats.reallocs++);
 	if (!block || !size) {
-		return libmin_malloc(size);
+		void *ret = __malloc(size);
+		STATS(if (ret) __stats_alloc(__builtin_return_address(0), size); else __stats.failed++);
+		return ret;
 	}
 
 	memhdr_t *header = (memhdr_t *) block - 1;
@@ -160,10 +266,73 @@ libmin_realloc(void *block, size_t size)
 		return block;
 	}
 
-	void *ret = libmin_malloc(size);
+	void *ret = __malloc(size);
+	STATS(if (ret) __stats_alloc(__builtin_return_address(0), size); else __stats.failed++);
 	if (ret) {
 		libmin_memcpy(ret, block, header->size);
 		libmin_free(block);
 	}
 	return ret;
 }
+
+#ifdef LIBMIN_MALLOC_STATS
+/* print the heap usage report, all lines are prefixed with "HEAP:" */
+void
+libmin_malloc_report(void)
+{
+	size_t free_blocks = 0, free_bytes = 0, largest_free = 0;
+
+	for (memhdr_t *current = head; current; current = current->next) {
+		if (current->is_free) {
+			free_blocks++;
+			free_bytes += current->size;
+			if (current->size > largest_free)
+				largest_free = current->size;
+		}
+	}
+
+	libmin_printf("HEAP: mallocs %lu, callocs %lu, reallocs %lu, frees %lu, failed %lu, reused %lu\n",
+		(unsigned long)__stats.mallocs, (unsigned long)__stats.callocs,
+		(unsigned long)__stats.reallocs, (unsigned long)__stats.frees,
+		(unsigned long)__stats.failed, (unsigned long)__stats.reused);
+	libmin_printf("HEAP: requested %lu bytes, peak live %lu bytes, peak footprint %lu bytes (memhdr %lu bytes)\n",
+		(unsigned long)__stats.req_bytes, (unsigned long)__stats.peak_live_bytes,
+		(unsigned long)__stats.peak_heap_bytes, (unsigned long)sizeof(memhdr_t));
+	libmin_printf("HEAP: at exit, live %lu bytes, footprint %lu bytes, %lu free blocks holding %lu bytes (largest %lu)\n",
+		(unsigned long)__stats.live_bytes, (unsigned long)__stats.heap_bytes,
+		(unsigned long)free_blocks, (unsigned long)free_bytes, (unsigned long)largest_free);
+	if (__stats.heap_bytes)
+		libmin_printf("HEAP: fragmentation %lu%% of footprint\n",
+			(unsigned long)((free_bytes * 100) / __stats.heap_bytes));
+
+	libmin_printf("HEAP: size class histogram:\n");
+	for (int i=0; i < STATS_NCLASSES; i++) {
+		if (!__stats.class_count[i])
+			continue;
+		if (i == STATS_NCLASSES-1)
+			libmin_printf("HEAP:   >%6lu: %8lu allocs, %10lu bytes\n",
+				(unsigned long)(16 << (i-1)), (unsigned long)__stats.class_count[i],
+				(unsigned long)__stats.class_bytes[i]);
+		else
+			libmin_printf("HEAP:  <=%6lu: %8lu allocs, %10lu bytes\n",
+				(unsigned long)(16 << i), (unsigned long)__stats.class_count[i],
+				(unsigned long)__stats.class_bytes[i]);
+	}
+
+	/* call sites are printed relative to libmin_malloc(), so they can be
+	   resolved against the link-time symbol table of position-independent
+	   executables as well as bare-metal images */
+	libmin_printf("HEAP: call sites (offsets from libmin_malloc):\n");
+	for (int i=0; i < STATS_NSITES && __stats.sites[i].site; i++)
+	{
+		long offset = (long)__stats.sites[i].site - (long)libmin_malloc;
+		libmin_printf("HEAP:   %c0x%lx: %8lu allocs, %10lu bytes\n",
+			offset < 0 ? '-' : '+', (unsigned long)(offset < 0 ? -offset : offset),
+			(unsigned long)__stats.sites[i].allocs,
+			(unsigned long)__stats.sites[i].bytes);
+	}
+	if (__stats.dropped_sites)
+		libmin_printf("HEAP:   (%lu allocs from untracked call sites)\n",
+			(unsigned long)__stats.dropped_sites);
+}
+#endif /* LIBMIN_MALLOC_STATS */
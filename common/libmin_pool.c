@@ -0,0 +1,85 @@
+#include "libmin.h"
+#include "libtarg.h"
+
+/* fixed-size object pool allocator, objects are carved from one contiguous
+   slab and recycled through a free list threaded through the free objects */
+
+/* initialize POOL with storage from the target heap for CAPACITY objects of
+   OBJ_SIZE bytes, returns FALSE if out of memory */
+int
+libmin_pool_init(libmin_pool_t *pool, size_t obj_size, size_t capacity)
+{
+  uint8_t *slab;
+  size_t slab_size;
+
+  /* objects must hold a free list link, and be aligned */
+  if (obj_size < sizeof(void *))
+    obj_size = sizeof(void *);
+  obj_size = (obj_size + LIBMIN_POOL_ALIGN_BYTES - 1) & ~(size_t)(LIBMIN_POOL_ALIGN_BYTES - 1);
+
+  /* the heap break may be unaligned, so reserve room to align the slab */
+  slab_size = obj_size * capacity + LIBMIN_POOL_ALIGN_BYTES - 1;
+  slab = libtarg_sbrk(slab_size);
+  if (slab == (void *)-1)
+  {
+    libmin_memset(pool, 0, sizeof(libmin_pool_t));
+    return FALSE;
+  }
+
+  pool->slab = slab;
+  pool->slab_size = slab_size;
+  pool->base = slab + (-(uintptr_t)slab & (LIBMIN_POOL_ALIGN_BYTES - 1));
+  pool->obj_size = obj_size;
+  pool->capacity = capacity;
+  pool->carved = 0;
+  pool->free_list = NULL;
+  pool->live = 0;
+  return TRUE;
+}
+
+/* allocate an object from POOL, returns NULL if the pool is exhausted */
+void *
+libmin_pool_alloc(libmin_pool_t *pool)
+{
+  void *obj;
+
+  if (pool->free_list != NULL)
+  {
+    /* recycle the most recently freed object */
+    obj = pool->free_list;
+    pool->free_list = *(void **)obj;
+  }
+  else if (pool->carved < pool->capacity)
+  {
+    /* carve the next object from the slab, in address order */
+    obj = pool->base + pool->carved * pool->obj_size;
+    pool->carved++;
+  }
+  else
+    return NULL;
+
+  pool->live++;
+  return obj;
+}
+
+/* return object OBJ to POOL */
+void
+libmin_pool_free(libmin_pool_t *pool, void *obj)
+{
+  if (obj == NULL)
+    return;
+
+  *(void **)obj = pool->free_list;
+  pool->free_list = obj;
+  pool->live--;
+}
+
+/* release POOL and all its objects, heap storage is returned to the target
+   if the slab is still at the top of the heap, otherwise it is abandoned */
+void
+libmin_pool_destroy(libmin_pool_t *pool)
+{
+  if (pool->slab && pool->slab + pool->slab_size == (uint8_t *)libtarg_sbrk(0))
+    libtarg_sbrk(0 - pool->slab_size);
+  libmin_memset(pool, 0, sizeof(libmin_pool_t));
+}
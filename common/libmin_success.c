@@ -4,5 +4,8 @@
 void
 libmin_success(void)
 {
+#ifdef LIBMIN_MALLOC_STATS
+  libmin_malloc_report();
+#endif /* LIBMIN_MALLOC_STATS */
   libtarg_success();
 }
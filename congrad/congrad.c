@@ -6,8 +6,10 @@
  *
  * - Deterministic init
  * - Tunable grid size (N*N system)
- * - Sparse CSR matrix
- * - Iterative solver with fixed max iterations
+ * - Sparse CSR matrix, or ELLPACK, SELL-C-sigma or diagonal (CG_FORMAT)
+ * - Laplacian or unstructured random SPD matrix (CG_RANDOM)
+ * - Plain, Jacobi or IC(0) preconditioned, or pipelined CG (CG_SOLVER)
+ * - Iterative solver with fixed max iterations, or to a tolerance (CG_TOL)
  * - Reports checksum of solution
  */
 
@@ -23,17 +25,83 @@
 #endif
 
 #ifndef CG_ITERS
+#ifdef CG_TOL
+#define CG_ITERS 1000        /* iteration limit, when solving to CG_TOL */
+#else
 #define CG_ITERS 25          /* number of CG iterations */
 #endif
+#endif
 
 #ifndef CG_FP
 #define CG_FP double         /* float or double */
 #endif
 
+/* sparse matrix formats */
+#define CG_CSR  0            /* compressed sparse rows */
+#define CG_ELL  1            /* ELLPACK, rows padded to the longest, column-major */
+#define CG_SELL 2            /* SELL-C-sigma, ELLPACK per slice of C sorted rows */
+#define CG_DIA  3            /* diagonal, one dense vector per nonzero diagonal */
+
+#ifndef CG_FORMAT
+#define CG_FORMAT CG_CSR     /* SpMV matrix format */
+#endif
+
+/* solvers */
+#define CG_PLAIN     0       /* unpreconditioned CG */
+#define CG_JACOBI    1       /* Jacobi (diagonal) preconditioned CG */
+#define CG_IC0       2       /* incomplete Cholesky IC(0) preconditioned CG */
+#define CG_PIPELINED 3       /* pipelined CG, one fused vector pass per iteration */
+
+#ifndef CG_SOLVER
+#define CG_SOLVER CG_PLAIN
+#endif
+
+#ifdef CG_RANDOM
+/* unstructured random matrix, symmetric and strictly diagonally dominant */
+#ifndef CG_NNZ_ROW
+#define CG_NNZ_ROW 9         /* average nonzeros per row, including the diagonal */
+#endif
+#ifndef CG_LOCALITY
+#define CG_LOCALITY 64       /* maximum distance of a nonzero from the diagonal */
+#endif
+#define CG_MAXNNZ (2*CG_NNZ_ROW)  /* maximum nonzeros per row */
+#define CG_MAXDIAG_DEFAULT (2*CG_LOCALITY+1)
+#else
+#define CG_MAXNNZ 5          /* 5-point stencil */
+#define CG_MAXDIAG_DEFAULT 5
+#endif
+
+#ifndef CG_SELL_C
+#define CG_SELL_C 8          /* SELL-C-sigma slice height (rows per slice) */
+#endif
+#ifndef CG_SELL_SIGMA
+#define CG_SELL_SIGMA 64     /* SELL-C-sigma sorting window (rows) */
+#endif
+#ifndef CG_MAXDIAG
+#define CG_MAXDIAG CG_MAXDIAG_DEFAULT  /* maximum nonzero diagonals, DIA format */
+#endif
+
 /* ---------------- Storage ---------------- */
 static int    row_ptr[CG_MAXN+1];
-static int    col_idx[CG_MAXN*5];   /* 5 nonzeros per row */
-static CG_FP  val[CG_MAXN*5];       /* values */
+static int    col_idx[CG_MAXN*CG_MAXNNZ];  /* up to CG_MAXNNZ nonzeros per row */
+static CG_FP  val[CG_MAXN*CG_MAXNNZ];      /* values */
+
+#if CG_FORMAT == CG_ELL
+static int    ell_width;                   /* nonzeros of the longest row */
+static int    ell_col[CG_MAXN*CG_MAXNNZ];  /* element k of row i at k*N+i */
+static CG_FP  ell_val[CG_MAXN*CG_MAXNNZ];
+#elif CG_FORMAT == CG_SELL
+#define CG_SELL_SLICES ((CG_MAXN+CG_SELL_C-1)/CG_SELL_C)
+static int    sell_ptr[CG_SELL_SLICES+1];  /* start of each slice */
+static int    sell_len[CG_SELL_SLICES];    /* nonzeros of the longest row of each slice */
+static int    sell_perm[CG_SELL_SLICES*CG_SELL_C];  /* row of each slice row, or -1 */
+static int    sell_col[CG_SELL_SLICES*CG_SELL_C*CG_MAXNNZ];  /* column-major per slice */
+static CG_FP  sell_val[CG_SELL_SLICES*CG_SELL_C*CG_MAXNNZ];
+#elif CG_FORMAT == CG_DIA
+static int    dia_count;                   /* number of nonzero diagonals */
+static int    dia_off[CG_MAXDIAG];         /* column offset of each diagonal */
+static CG_FP  dia_val[CG_MAXDIAG*CG_MAXN]; /* element of row i of diagonal d at d*N+i */
+#endif
 
 static CG_FP  x[CG_MAXN];
 static CG_FP  b[CG_MAXN];
@@ -41,6 +109,21 @@ static CG_FP  r[CG_MAXN];
 static CG_FP  p[CG_MAXN];
 static CG_FP  Ap[CG_MAXN];
 
+#if CG_SOLVER == CG_JACOBI
+static CG_FP  z[CG_MAXN];                  /* preconditioned residual */
+static CG_FP  inv_diag[CG_MAXN];           /* inverse of the diagonal of A */
+#elif CG_SOLVER == CG_IC0
+static CG_FP  z[CG_MAXN];                  /* preconditioned residual */
+static int    ic_ptr[CG_MAXN+1];           /* lower triangle of A in CSR, rows */
+static int    ic_col[CG_MAXN*CG_MAXNNZ];   /* sorted by column, diagonal last */
+static CG_FP  ic_val[CG_MAXN*CG_MAXNNZ];   /* factor L, A ~= L*L^T */
+#elif CG_SOLVER == CG_PIPELINED
+static CG_FP  w[CG_MAXN];                  /* A*r */
+static CG_FP  q[CG_MAXN];                  /* A*w */
+static CG_FP  s[CG_MAXN];                  /* A*p */
+static CG_FP  zv[CG_MAXN];                 /* A*s */
+#endif
+
 /* ---------------- Simple RNG for init ---------------- */
 static uint32_t cg_rng = 0x12345678u;
 static inline uint32_t cg_lcg(void) {
@@ -52,6 +135,61 @@ static inline CG_FP cg_urand(void) {
 }
 
 /* ---------------- Sparse Laplacian Matrix ---------------- */
+#ifdef CG_RANDOM
+/* random symmetric matrix of N = n*n rows, with about CG_NNZ_ROW nonzeros per
+   row at most CG_LOCALITY columns from the diagonal, and a diagonal that
+   dominates its row, so it is positive definite */
+static void cg_build_matrix(int n) {
+    int N = n*n;
+
+    /* rows are first built at a stride of CG_MAXNNZ, diagonal first */
+    for (int i = 0; i < N; i++) {
+        row_ptr[i] = 1;
+        col_idx[i*CG_MAXNNZ] = i;
+        val[i*CG_MAXNNZ] = 1.0;
+    }
+    for (int i = 0; i < N; i++) {
+        for (int t = 0; t < (CG_NNZ_ROW-1)/2; t++) {
+            int j = i + 1 + (int)(cg_lcg() % CG_LOCALITY);
+            CG_FP v = -(cg_urand() + (CG_FP)0.125);
+            if (j >= N || row_ptr[i] == CG_MAXNNZ || row_ptr[j] == CG_MAXNNZ)
+                continue;
+            int dup = 0;
+            for (int k = 1; k < row_ptr[i]; k++)
+                dup |= (col_idx[i*CG_MAXNNZ+k] == j);
+            if (dup)
+                continue;
+            col_idx[i*CG_MAXNNZ+row_ptr[i]] = j; val[i*CG_MAXNNZ+row_ptr[i]++] = v;
+            col_idx[j*CG_MAXNNZ+row_ptr[j]] = i; val[j*CG_MAXNNZ+row_ptr[j]++] = v;
+            val[i*CG_MAXNNZ] -= v;
+            val[j*CG_MAXNNZ] -= v;
+        }
+    }
+
+    /* sort each row by column, and pack the rows */
+    int nnz = 0;
+    for (int i = 0; i < N; i++) {
+        int len = row_ptr[i], *cols = &col_idx[i*CG_MAXNNZ];
+        CG_FP *vals = &val[i*CG_MAXNNZ];
+        for (int k = 1; k < len; k++) {
+            int c = cols[k], m = k;
+            CG_FP v = vals[k];
+            for (; m > 0 && cols[m-1] > c; m--) {
+                cols[m] = cols[m-1];
+                vals[m] = vals[m-1];
+            }
+            cols[m] = c;
+            vals[m] = v;
+        }
+        row_ptr[i] = nnz;
+        for (int k = 0; k < len; k++) {
+            col_idx[nnz] = cols[k];
+            val[nnz++] = vals[k];
+        }
+    }
+    row_ptr[N] = nnz;
+}
+#else /* !CG_RANDOM */
 static void cg_build_matrix(int n) {
     int N = n*n;
     int nnz = 0;
@@ -60,19 +198,162 @@ static void cg_build_matrix(int n) {
         int row = i / n;
         int col = i % n;
 
-        // center
-        col_idx[nnz] = i; val[nnz++] = 4.0;
-
-        // neighbors
+        // neighbors and center, in ascending column order, the order in
+        // which every format sums a row
         if (row > 0)    { col_idx[nnz] = i-n; val[nnz++] = -1.0; }
-        if (row < n-1)  { col_idx[nnz] = i+n; val[nnz++] = -1.0; }
         if (col > 0)    { col_idx[nnz] = i-1; val[nnz++] = -1.0; }
+        col_idx[nnz] = i; val[nnz++] = 4.0;
         if (col < n-1)  { col_idx[nnz] = i+1; val[nnz++] = -1.0; }
+        if (row < n-1)  { col_idx[nnz] = i+n; val[nnz++] = -1.0; }
     }
     row_ptr[N] = nnz;
 }
+#endif /* CG_RANDOM */
+
+/* ---------------- Format Conversion ---------------- */
+#if CG_FORMAT == CG_ELL
+static void cg_build_format(int N) {
+    ell_width = 0;
+    for (int i = 0; i < N; i++)
+        ell_width = MAX(ell_width, row_ptr[i+1] - row_ptr[i]);
+
+    /* short rows are padded with zeros, at their own column */
+    for (int i = 0; i < N; i++) {
+        int len = row_ptr[i+1] - row_ptr[i];
+        for (int k = 0; k < ell_width; k++) {
+            ell_col[k*N+i] = (k < len) ? col_idx[row_ptr[i]+k] : i;
+            ell_val[k*N+i] = (k < len) ? val[row_ptr[i]+k] : (CG_FP)0;
+        }
+    }
+}
+#elif CG_FORMAT == CG_SELL
+static void cg_build_format(int N) {
+    int slices = (N + CG_SELL_C - 1) / CG_SELL_C;
+
+    /* sort the rows by decreasing length within each sorting window, so the
+       rows of a slice have similar lengths */
+    for (int i = 0; i < slices*CG_SELL_C; i++)
+        sell_perm[i] = (i < N) ? i : -1;
+    for (int w = 0; w < N; w += CG_SELL_SIGMA) {
+        int end = MIN(w + CG_SELL_SIGMA, N);
+        for (int i = w + 1; i < end; i++) {
+            int row = sell_perm[i], len = row_ptr[row+1] - row_ptr[row], m = i;
+            for (; m > w && row_ptr[sell_perm[m-1]+1] - row_ptr[sell_perm[m-1]] < len; m--)
+                sell_perm[m] = sell_perm[m-1];
+            sell_perm[m] = row;
+        }
+    }
+
+    /* store each slice as a column-major ELLPACK block */
+    sell_ptr[0] = 0;
+    for (int s = 0; s < slices; s++) {
+        int width = 0;
+        for (int r = 0; r < CG_SELL_C; r++) {
+            int row = sell_perm[s*CG_SELL_C+r];
+            if (row >= 0)
+                width = MAX(width, row_ptr[row+1] - row_ptr[row]);
+        }
+        sell_len[s] = width;
+        for (int r = 0; r < CG_SELL_C; r++) {
+            int row = sell_perm[s*CG_SELL_C+r];
+            int len = (row >= 0) ? row_ptr[row+1] - row_ptr[row] : 0;
+            for (int k = 0; k < width; k++) {
+                int e = sell_ptr[s] + k*CG_SELL_C + r;
+                sell_col[e] = (k < len) ? col_idx[row_ptr[row]+k] : 0;
+                sell_val[e] = (k < len) ? val[row_ptr[row]+k] : (CG_FP)0;
+            }
+        }
+        sell_ptr[s+1] = sell_ptr[s] + width*CG_SELL_C;
+    }
+}
+#elif CG_FORMAT == CG_DIA
+static void cg_build_format(int N) {
+    /* find the nonzero diagonals, in increasing order of offset */
+    dia_count = 0;
+    for (int i = 0; i < N; i++) {
+        for (int j = row_ptr[i]; j < row_ptr[i+1]; j++) {
+            int off = col_idx[j] - i, d = 0;
+            while (d < dia_count && dia_off[d] < off)
+                d++;
+            if (d < dia_count && dia_off[d] == off)
+                continue;
+            if (dia_count == CG_MAXDIAG) {
+                libmin_printf("ERROR: matrix has more than CG_MAXDIAG=%d diagonals\n", CG_MAXDIAG);
+                libmin_fail(1);
+            }
+            for (int m = dia_count++; m > d; m--)
+                dia_off[m] = dia_off[m-1];
+            dia_off[d] = off;
+        }
+    }
+
+    for (int d = 0; d < dia_count; d++) {
+        for (int i = 0; i < N; i++)
+            dia_val[d*N+i] = 0;
+    }
+    for (int i = 0; i < N; i++) {
+        for (int j = row_ptr[i]; j < row_ptr[i+1]; j++) {
+            int d = 0;
+            while (dia_off[d] != col_idx[j] - i)
+                d++;
+            dia_val[d*N+i] = val[j];
+        }
+    }
+}
+#else /* CG_CSR */
+static void cg_build_format(int N) {
+    (void)N;  /* the matrix is built in CSR */
+}
+#endif /* CG_FORMAT */
 
 /* ---------------- Sparse MatVec: y = A*x ---------------- */
+#if CG_FORMAT == CG_ELL
+static void cg_spmv(CG_FP *y, const CG_FP *x, int N) {
+    for (int i = 0; i < N; i++)
+        y[i] = 0;
+    /* one unit-stride sweep over all rows per column of the format */
+    for (int k = 0; k < ell_width; k++) {
+        const int *cols = &ell_col[k*N];
+        const CG_FP *vals = &ell_val[k*N];
+        for (int i = 0; i < N; i++)
+            y[i] += vals[i] * x[cols[i]];
+    }
+}
+#elif CG_FORMAT == CG_SELL
+static void cg_spmv(CG_FP *y, const CG_FP *x, int N) {
+    int slices = (N + CG_SELL_C - 1) / CG_SELL_C;
+    for (int s = 0; s < slices; s++) {
+        CG_FP sum[CG_SELL_C];
+        const int *cols = &sell_col[sell_ptr[s]];
+        const CG_FP *vals = &sell_val[sell_ptr[s]];
+        for (int r = 0; r < CG_SELL_C; r++)
+            sum[r] = 0;
+        /* C rows advance together, one column of the slice at a time */
+        for (int k = 0; k < sell_len[s]; k++) {
+            for (int r = 0; r < CG_SELL_C; r++)
+                sum[r] += vals[k*CG_SELL_C+r] * x[cols[k*CG_SELL_C+r]];
+        }
+        for (int r = 0; r < CG_SELL_C; r++) {
+            int row = sell_perm[s*CG_SELL_C+r];
+            if (row >= 0)
+                y[row] = sum[r];
+        }
+    }
+}
+#elif CG_FORMAT == CG_DIA
+static void cg_spmv(CG_FP *y, const CG_FP *x, int N) {
+    for (int i = 0; i < N; i++)
+        y[i] = 0;
+    /* one unit-stride sweep of x per diagonal, no column indices */
+    for (int d = 0; d < dia_count; d++) {
+        int off = dia_off[d];
+        int lo = MAX(0, -off), hi = MIN(N, N - off);
+        const CG_FP *vals = &dia_val[d*N];
+        for (int i = lo; i < hi; i++)
+            y[i] += vals[i] * x[i+off];
+    }
+}
+#else /* CG_CSR */
 static void cg_spmv(CG_FP *y, const CG_FP *x, int N) {
     for (int i = 0; i < N; i++) {
         CG_FP sum = 0;
@@ -82,6 +363,7 @@ static void cg_spmv(CG_FP *y, const CG_FP *x, int N) {
         y[i] = sum;
     }
 }
+#endif /* CG_FORMAT */
 
 /* ---------------- Vector ops ---------------- */
 static inline CG_FP cg_dot(const CG_FP *a, const CG_FP *b, int N) {
@@ -96,21 +378,183 @@ static inline void cg_copy(CG_FP *dst, const CG_FP *src, int N) {
     for (int i = 0; i < N; i++) dst[i] = src[i];
 }
 
+/* ---------------- Preconditioners: z = M^-1 * r ---------------- */
+#if CG_SOLVER == CG_JACOBI
+static void cg_precond_setup(int N) {
+    for (int i = 0; i < N; i++) {
+        for (int j = row_ptr[i]; j < row_ptr[i+1]; j++) {
+            if (col_idx[j] == i)
+                inv_diag[i] = 1.0 / val[j];
+        }
+    }
+}
+
+static void cg_precond(CG_FP *zo, const CG_FP *ri, int N) {
+    for (int i = 0; i < N; i++)
+        zo[i] = inv_diag[i] * ri[i];
+}
+#elif CG_SOLVER == CG_IC0
+/* incomplete Cholesky factorization with the nonzero pattern of the lower
+   triangle of A, L[i][k] = (A[i][k] - sum_j L[i][j]*L[k][j]) / L[k][k] for
+   the nonzeros of row i in column order, then L[i][i] */
+static void cg_precond_setup(int N) {
+    int nnz = 0;
+    for (int i = 0; i < N; i++) {
+        ic_ptr[i] = nnz;
+        for (int j = row_ptr[i]; j < row_ptr[i+1]; j++) {
+            int c = col_idx[j], m = nnz;
+            if (c > i)
+                continue;
+            for (; m > ic_ptr[i] && ic_col[m-1] > c; m--) {
+                ic_col[m] = ic_col[m-1];
+                ic_val[m] = ic_val[m-1];
+            }
+            ic_col[m] = c;
+            ic_val[m] = val[j];
+            nnz++;
+        }
+    }
+    ic_ptr[N] = nnz;
+
+    for (int i = 0; i < N; i++) {
+        for (int e = ic_ptr[i]; e < ic_ptr[i+1]; e++) {
+            int k = ic_col[e];
+            CG_FP sum = ic_val[e];
+
+            /* sum over the columns j < k in both row i and row k */
+            int a = ic_ptr[i], c = ic_ptr[k];
+            while (a < e && c < ic_ptr[k+1]-1) {
+                if (ic_col[a] < ic_col[c]) a++;
+                else if (ic_col[a] > ic_col[c]) c++;
+                else sum -= ic_val[a++] * ic_val[c++];
+            }
+            if (k < i) {
+                ic_val[e] = sum / ic_val[ic_ptr[k+1]-1];
+            }
+            else {
+                if (sum <= 0) {
+                    libmin_printf("ERROR: IC(0) factorization broke down at row %d\n", i);
+                    libmin_fail(1);
+                }
+                ic_val[e] = libmin_sqrt(sum);
+            }
+        }
+    }
+}
+
+static void cg_precond(CG_FP *zo, const CG_FP *ri, int N) {
+    /* forward solve L*y = r */
+    for (int i = 0; i < N; i++) {
+        CG_FP sum = ri[i];
+        for (int e = ic_ptr[i]; e < ic_ptr[i+1]-1; e++)
+            sum -= ic_val[e] * zo[ic_col[e]];
+        zo[i] = sum / ic_val[ic_ptr[i+1]-1];
+    }
+    /* backward solve L^T*z = y, by columns of L^T (rows of L) */
+    for (int i = N-1; i >= 0; i--) {
+        zo[i] /= ic_val[ic_ptr[i+1]-1];
+        for (int e = ic_ptr[i]; e < ic_ptr[i+1]-1; e++)
+            zo[ic_col[e]] -= ic_val[e] * zo[i];
+    }
+}
+#endif /* CG_SOLVER */
+
 /* ---------------- Conjugate Gradient ---------------- */
-static void cg_solve(int n) {
-    int N = n*n;
+/* solve A*x = b for a random b, returns the number of iterations */
 
-    // init vectors
+/* start a solve with x = 0, a random b and the residual r = b - A*x, returns
+   the threshold iterations stop at once r.r drops below it, from CG_TOL the
+   relative residual |r|/|b| */
+static CG_FP cg_start(int N) {
     for (int i = 0; i < N; i++) {
         x[i] = 0.0;
         b[i] = cg_urand();
     }
-
     cg_spmv(Ap, x, N);
-    for (int i = 0; i < N; i++) {
+    for (int i = 0; i < N; i++)
         r[i] = b[i] - Ap[i];
-        p[i] = r[i];
+#ifdef CG_TOL
+    return (CG_FP)CG_TOL * (CG_FP)CG_TOL * cg_dot(b,b,N);
+#else
+    return 1e-12;
+#endif
+}
+
+#if CG_SOLVER == CG_JACOBI || CG_SOLVER == CG_IC0
+static int cg_solve(int n) {
+    int N = n*n;
+
+    CG_FP stop = cg_start(N);
+    cg_precond_setup(N);
+
+    cg_precond(z, r, N);
+    cg_copy(p, z, N);
+
+    CG_FP rzold = cg_dot(r,z,N);
+
+    for (int k = 0; k < CG_ITERS; k++) {
+        cg_spmv(Ap, p, N);
+        CG_FP alpha = rzold / cg_dot(p,Ap,N);
+        cg_axpy(x, p, alpha, N);
+        cg_axpy(r, Ap, -alpha, N);
+
+        if (cg_dot(r,r,N) < stop) return k+1;
+
+        cg_precond(z, r, N);
+        CG_FP rznew = cg_dot(r,z,N);
+        CG_FP beta = rznew / rzold;
+        for (int i = 0; i < N; i++)
+            p[i] = z[i] + beta*p[i];
+
+        rzold = rznew;
     }
+    return CG_ITERS;
+}
+#elif CG_SOLVER == CG_PIPELINED
+/* pipelined CG (Ghysels and Vanroose), the recurrences s = A*p, zv = A*s and
+   w = A*r let the SpMV q = A*w of an iteration be independent of its dot
+   products, and the vector updates and the dot products of the next
+   iteration are fused into a single pass */
+static int cg_solve(int n) {
+    int N = n*n;
+
+    CG_FP stop = cg_start(N);
+    for (int i = 0; i < N; i++)
+        p[i] = s[i] = zv[i] = 0.0;
+    cg_spmv(w, r, N);
+
+    CG_FP gamma = cg_dot(r,r,N), delta = cg_dot(w,r,N);
+    CG_FP gamma_old = 1.0, alpha = 1.0;
+
+    for (int k = 0; k < CG_ITERS; k++) {
+        if (gamma < stop) return k;
+
+        cg_spmv(q, w, N);
+
+        CG_FP beta = (k > 0) ? gamma / gamma_old : (CG_FP)0.0;
+        alpha = gamma / (delta - beta * gamma / alpha);
+        gamma_old = gamma;
+
+        gamma = delta = 0.0;
+        for (int i = 0; i < N; i++) {
+            zv[i] = q[i] + beta*zv[i];
+            s[i] = w[i] + beta*s[i];
+            p[i] = r[i] + beta*p[i];
+            x[i] += alpha*p[i];
+            r[i] -= alpha*s[i];
+            w[i] -= alpha*zv[i];
+            gamma += r[i]*r[i];
+            delta += w[i]*r[i];
+        }
+    }
+    return CG_ITERS;
+}
+#else /* CG_PLAIN */
+static int cg_solve(int n) {
+    int N = n*n;
+
+    CG_FP stop = cg_start(N);
+    cg_copy(p, r, N);
 
     CG_FP rsold = cg_dot(r,r,N);
 
@@ -121,7 +565,7 @@ static void cg_solve(int n) {
         cg_axpy(r, Ap, -alpha, N);
 
         CG_FP rsnew = cg_dot(r,r,N);
-        if (rsnew < 1e-12) break;
+        if (rsnew < stop) return k+1;
 
         CG_FP beta = rsnew / rsold;
         for (int i = 0; i < N; i++)
@@ -129,7 +573,9 @@ static void cg_solve(int n) {
 
         rsold = rsnew;
     }
+    return CG_ITERS;
 }
+#endif /* CG_SOLVER */
 
 /* ---------------- Checksum ---------------- */
 static uint64_t cg_checksum(int N) {
@@ -146,11 +592,15 @@ volatile uint64_t cg_sink;
 
 int main(void) {
     cg_build_matrix(CG_N);
-    cg_solve(CG_N);
+    cg_build_format(CG_N*CG_N);
+
+    libtarg_start_perf();
+    int iters = cg_solve(CG_N);
+    libtarg_stop_perf();
     uint64_t sum = cg_checksum(CG_N*CG_N);
 
     libmin_printf("cg: N=%d iters=%d checksum=0x%08x%08x\n",
-           CG_N, CG_ITERS, (uint32_t)(sum >> 32), (uint32_t)sum);
+           CG_N, iters, (uint32_t)(sum >> 32), (uint32_t)sum);
 
     libmin_success();
 }
@@ -1,5 +1,13 @@
 #include "libmin.h"
 
+// Search engine, define BITBOARD to select the bitboard engine (negamax with
+// alpha-beta, center-first move ordering and a Zobrist-hashed transposition
+// table), otherwise the array engine is used.
+//
+// Bitboard engine parameters:
+//   BB_DEPTH - search depth in plies (default 10)
+//   TT_BITS  - log2 of the transposition table entries (default 16, 1 MB)
+
 #define ROWS 6
 #define COLS 7
 #define MAX_DEPTH 4
@@ -278,6 +286,300 @@ int minimax(int board[ROWS][COLS], int depth, int alpha, int beta, int maximizin
     return best_score;
 }
 
+#ifdef BITBOARD
+// -------------------------------------------------
+// Bitboard Engine
+// -------------------------------------------------
+
+#ifndef BB_DEPTH
+#define BB_DEPTH 10
+#endif
+#ifndef TT_BITS
+#define TT_BITS 16
+#endif
+
+// Each column is 7 bits, bit (col * H1 + row) is the cell in row "row"
+// counted from the bottom; the bit above each column is always empty, so
+// shifted lines cannot wrap from one column into the next.
+#define H1 (ROWS + 1)
+#define BB_BIT(col, row) ((uint64_t)1 << ((col) * H1 + (row)))
+
+typedef struct {
+    uint64_t bb[2];     // stones of player 1 and player 2
+    int height[COLS];   // bit index of the next free cell in each column
+    int side;           // side to move, 0 or 1
+    int moves;          // number of stones on the board
+    uint64_t key;       // Zobrist hash of the position
+} bb_state_t;
+
+// transposition table entry
+#define TT_EXACT 0
+#define TT_LOWER 1
+#define TT_UPPER 2
+typedef struct {
+    uint64_t key;
+    int score;
+    int8_t depth;
+    int8_t flag;
+    int8_t move;
+} tt_entry_t;
+
+static tt_entry_t tt[1 << TT_BITS];
+static uint64_t zobrist[2][COLS * H1];
+static uint64_t zobrist_side;
+
+// all 69 lines of four cells, for the heuristic evaluation
+#define NUM_WINDOWS 69
+static uint64_t windows[NUM_WINDOWS];
+static uint64_t center_mask;
+
+// center-first move order
+static const int move_order[COLS] = { 3, 2, 4, 1, 5, 0, 6 };
+
+// search statistics
+static long bb_nodes, bb_tt_hits, bb_tt_cutoffs;
+
+static uint64_t rand64(void) {
+    uint64_t r = 0;
+    for (int i = 0; i < 4; i++)
+        r = (r << 16) ^ libmin_rand();
+    return r;
+}
+
+void bb_init_tables(void) {
+    int n = 0;
+    static const int dc[4] = { 1, 0, 1, 1 }, dr[4] = { 0, 1, 1, -1 };
+
+    for (int i = 0; i < 2; i++)
+        for (int b = 0; b < COLS * H1; b++)
+            zobrist[i][b] = rand64();
+    zobrist_side = rand64();
+
+    for (int d = 0; d < 4; d++) {
+        for (int c = 0; c < COLS; c++) {
+            for (int r = 0; r < ROWS; r++) {
+                int ec = c + 3 * dc[d], er = r + 3 * dr[d];
+                if (ec >= COLS || er < 0 || er >= ROWS)
+                    continue;
+                uint64_t w = 0;
+                for (int i = 0; i < 4; i++)
+                    w |= BB_BIT(c + i * dc[d], r + i * dr[d]);
+                windows[n++] = w;
+            }
+        }
+    }
+    center_mask = 0;
+    for (int r = 0; r < ROWS; r++)
+        center_mask |= BB_BIT(COLS/2, r);
+    libmin_memset(tt, 0, sizeof(tt));
+}
+
+void bb_init(bb_state_t *s) {
+    s->bb[0] = s->bb[1] = 0;
+    for (int c = 0; c < COLS; c++)
+        s->height[c] = c * H1;
+    s->side = 0;
+    s->moves = 0;
+    s->key = 0;
+}
+
+static inline int bb_can_play(const bb_state_t *s, int col) {
+    return s->height[col] < col * H1 + ROWS;
+}
+
+static inline void bb_play(bb_state_t *s, int col) {
+    int b = s->height[col]++;
+    s->bb[s->side] |= (uint64_t)1 << b;
+    s->key ^= zobrist[s->side][b] ^ zobrist_side;
+    s->side ^= 1;
+    s->moves++;
+}
+
+static inline void bb_undo(bb_state_t *s, int col) {
+    int b = --s->height[col];
+    s->side ^= 1;
+    s->bb[s->side] &= ~((uint64_t)1 << b);
+    s->key ^= zobrist[s->side][b] ^ zobrist_side;
+    s->moves--;
+}
+
+// Returns 1 if the stones in p contain four in a row.
+static inline int bb_won(uint64_t p) {
+    uint64_t m;
+    m = p & (p >> H1);          // horizontal
+    if (m & (m >> (2 * H1))) return 1;
+    m = p & (p >> (H1 - 1));    // diagonal, down to the right
+    if (m & (m >> (2 * (H1 - 1)))) return 1;
+    m = p & (p >> (H1 + 1));    // diagonal, up to the right
+    if (m & (m >> (2 * (H1 + 1)))) return 1;
+    m = p & (p >> 1);           // vertical
+    if (m & (m >> 2)) return 1;
+    return 0;
+}
+
+static inline int popcount(uint64_t x) {
+    int n = 0;
+    while (x) {
+        x &= x - 1;
+        n++;
+    }
+    return n;
+}
+
+// Score the stones of "me" against the stones of "opp", using the same
+// window scoring as score_position().
+static int bb_score_player(uint64_t me, uint64_t opp) {
+    int score = popcount(me & center_mask) * 3;
+    for (int i = 0; i < NUM_WINDOWS; i++) {
+        uint64_t w = windows[i];
+        int count_player = popcount(me & w), count_opp = popcount(opp & w);
+        int count_empty = 4 - count_player - count_opp;
+        if (count_player == 4)
+            score += 100;
+        else if (count_player == 3 && count_empty == 1)
+            score += 5;
+        else if (count_player == 2 && count_empty == 2)
+            score += 2;
+        if (count_opp == 3 && count_empty == 1)
+            score -= 4;
+    }
+    return score;
+}
+
+// Heuristic score from the perspective of the side to move.
+static int bb_evaluate(const bb_state_t *s) {
+    uint64_t me = s->bb[s->side], opp = s->bb[s->side ^ 1];
+    return bb_score_player(me, opp) - bb_score_player(opp, me);
+}
+
+// Negamax with alpha-beta pruning and a transposition table, returns the
+// score of the position from the perspective of the side to move.
+static int bb_negamax(bb_state_t *s, int depth, int alpha, int beta) {
+    bb_nodes++;
+
+    // the previous move may have won the game, a quicker win scores higher
+    if (bb_won(s->bb[s->side ^ 1]))
+        return LOSS_SCORE - depth;
+    if (s->moves == ROWS * COLS)
+        return 0;
+    if (depth == 0)
+        return bb_evaluate(s);
+
+    int alpha_orig = alpha;
+    int tt_move = -1;
+    tt_entry_t *e = &tt[s->key & ((1 << TT_BITS) - 1)];
+    if (e->key == s->key) {
+        bb_tt_hits++;
+        tt_move = e->move;
+        if (e->depth >= depth) {
+            if (e->flag == TT_EXACT ||
+                (e->flag == TT_LOWER && e->score >= beta) ||
+                (e->flag == TT_UPPER && e->score <= alpha)) {
+                bb_tt_cutoffs++;
+                return e->score;
+            }
+        }
+    }
+
+    int best_score = INT_MIN, best_move = -1;
+    for (int i = -1; i < COLS; i++) {
+        // the transposition table move first, then center-first
+        int col = (i < 0) ? tt_move : move_order[i];
+        if (col < 0 || (i >= 0 && col == tt_move) || !bb_can_play(s, col))
+            continue;
+        bb_play(s, col);
+        int score = -bb_negamax(s, depth - 1, -beta, -alpha);
+        bb_undo(s, col);
+        if (score > best_score) {
+            best_score = score;
+            best_move = col;
+        }
+        if (best_score > alpha)
+            alpha = best_score;
+        if (alpha >= beta)
+            break;
+    }
+
+    // always replace
+    e->key = s->key;
+    e->score = best_score;
+    e->depth = depth;
+    e->move = best_move;
+    if (best_score <= alpha_orig)
+        e->flag = TT_UPPER;
+    else if (best_score >= beta)
+        e->flag = TT_LOWER;
+    else
+        e->flag = TT_EXACT;
+    return best_score;
+}
+
+// Search the root position, returns the best score and sets *best_move.
+int bb_search(bb_state_t *s, int depth, int *best_move) {
+    int alpha = LOSS_SCORE - BB_DEPTH - 1, beta = WIN_SCORE + BB_DEPTH + 1;
+    *best_move = -1;
+    for (int i = 0; i < COLS; i++) {
+        int col = move_order[i];
+        if (!bb_can_play(s, col))
+            continue;
+        bb_play(s, col);
+        int score = -bb_negamax(s, depth - 1, -beta, -alpha);
+        bb_undo(s, col);
+        if (score > alpha || *best_move == -1) {
+            alpha = score;
+            *best_move = col;
+        }
+    }
+    return alpha;
+}
+
+// Convert the bitboards to an array board, for printing.
+void bb_to_board(const bb_state_t *s, int board[ROWS][COLS]) {
+    for (int r = 0; r < ROWS; r++)
+        for (int c = 0; c < COLS; c++) {
+            uint64_t b = BB_BIT(c, ROWS - 1 - r);
+            board[r][c] = (s->bb[0] & b) ? 1 : ((s->bb[1] & b) ? 2 : EMPTY);
+        }
+}
+
+// -------------------------------------------------
+// Main Simulation Loop: Self-play game using the bitboard engine
+// -------------------------------------------------
+void play_game() {
+    int board[ROWS][COLS];
+    bb_state_t s;
+
+    bb_init_tables();
+    bb_init(&s);
+    bb_to_board(&s, board);
+    print_board(board);
+
+    int move_number = 0;
+    while (1) {
+        int current_player = s.side + 1;
+        int best_move;
+        move_number++;
+        int score = bb_search(&s, BB_DEPTH, &best_move);
+        if (best_move == -1)
+            break;
+        bb_play(&s, best_move);
+        libmin_printf("Move %d: Player %d drops in column %d (score=%d)\n", move_number, current_player, best_move, score);
+        bb_to_board(&s, board);
+        print_board(board);
+
+        if (bb_won(s.bb[current_player - 1])) {
+            libmin_printf("Player %d wins!\n", current_player);
+            break;
+        }
+        if (s.moves == ROWS * COLS) {
+            libmin_printf("Game is a draw.\n");
+            break;
+        }
+    }
+    libmin_printf("Search: %ld nodes, %ld TT hits, %ld TT cutoffs\n", bb_nodes, bb_tt_hits, bb_tt_cutoffs);
+}
+
+#else /* !BITBOARD */
 // -------------------------------------------------
 // Main Simulation Loop: Self-play game using minimax
 // -------------------------------------------------
@@ -315,6 +617,7 @@ void play_game() {
         current_player = (current_player == 1) ? 2 : 1;
     }
 }
+#endif /* BITBOARD */
 
 int main(void) {
     libmin_srand(42);
@@ -113,7 +113,7 @@ int main() {
     }
     libmin_printf("Hull size: %d, Checksum: %d\n", hullSize, checksum);
 
-    libtarg_success();
+    libmin_success();
     return 0;
 }
 
@@ -0,0 +1,143 @@
+/*
+ * BLIS-style blocked GEMM, C = alpha * A * B + beta * C, for row-major
+ * matrices. This file is included once per element type by gemm.c, with
+ * GEMM_T defined to the element type and GEMM_FN(name) to the name of each
+ * function for that type.
+ *
+ * The loops around the micro-kernel block the matrices for the caches: an
+ * NC-column panel of B is split into KC-deep slices (the packed slice lives
+ * in L3/L2), and an MC-row block of A is packed per slice (it lives in L2).
+ * Packing copies the blocks into MR-row and NR-column micro-panels, in the
+ * order the micro-kernel reads them, padded with zeros at the edges. The
+ * micro-kernel then updates an MR x NR tile of C held in registers, reading
+ * one column of the A micro-panel and one row of the B micro-panel (which
+ * lives in L1) per step of k.
+ */
+
+/* pack an mc x kc block of A into MR-row micro-panels */
+static void
+GEMM_FN(pack_a)(int mc, int kc, const GEMM_T *A, int lda, GEMM_T *Ap)
+{
+  for (int ir = 0; ir < mc; ir += GEMM_MR)
+  {
+    for (int p = 0; p < kc; p++)
+    {
+      for (int i = 0; i < GEMM_MR; i++)
+        *Ap++ = (ir + i < mc) ? A[(ir + i) * lda + p] : (GEMM_T)0;
+    }
+  }
+}
+
+/* pack a kc x nc block of B into NR-column micro-panels */
+static void
+GEMM_FN(pack_b)(int kc, int nc, const GEMM_T *B, int ldb, GEMM_T *Bp)
+{
+  for (int jr = 0; jr < nc; jr += GEMM_NR)
+  {
+    for (int p = 0; p < kc; p++)
+    {
+      for (int j = 0; j < GEMM_NR; j++)
+        *Bp++ = (jr + j < nc) ? B[p * ldb + jr + j] : (GEMM_T)0;
+    }
+  }
+}
+
+/* C[0:mr][0:nr] += alpha * Ap * Bp, for micro-panels of depth kc */
+static void
+GEMM_FN(micro_kernel)(int kc, GEMM_T alpha, const GEMM_T *Ap, const GEMM_T *Bp,
+                      GEMM_T *C, int ldc, int mr, int nr)
+{
+#ifdef GEMM_VECTOR
+  /* one vector register per row of the tile, mapped by the compiler to SSE/AVX,
+     NEON or RVV when the target supports it */
+  typedef GEMM_T vec_t __attribute__((vector_size(GEMM_NR * sizeof(GEMM_T))));
+  vec_t ab[GEMM_MR];
+
+  for (int i = 0; i < GEMM_MR; i++)
+    ab[i] = (vec_t){0};
+
+  for (int p = 0; p < kc; p++)
+  {
+    vec_t b = *(const vec_t *)&Bp[p * GEMM_NR];
+    for (int i = 0; i < GEMM_MR; i++)
+      ab[i] += Ap[p * GEMM_MR + i] * b;
+  }
+
+  for (int i = 0; i < mr; i++)
+  {
+    for (int j = 0; j < nr; j++)
+      C[i * ldc + j] += alpha * ab[i][j];
+  }
+#else /* !GEMM_VECTOR */
+  GEMM_T ab[GEMM_MR][GEMM_NR];
+
+  for (int i = 0; i < GEMM_MR; i++)
+  {
+    for (int j = 0; j < GEMM_NR; j++)
+      ab[i][j] = 0;
+  }
+
+  for (int p = 0; p < kc; p++)
+  {
+    const GEMM_T *a = &Ap[p * GEMM_MR];
+    const GEMM_T *b = &Bp[p * GEMM_NR];
+
+    for (int i = 0; i < GEMM_MR; i++)
+    {
+      for (int j = 0; j < GEMM_NR; j++)
+        ab[i][j] += a[i] * b[j];
+    }
+  }
+
+  for (int i = 0; i < mr; i++)
+  {
+    for (int j = 0; j < nr; j++)
+      C[i * ldc + j] += alpha * ab[i][j];
+  }
+#endif /* GEMM_VECTOR */
+}
+
+static void
+GEMM_FN(blocked_gemm)(int m, int n, int k, GEMM_T alpha,
+                      const GEMM_T *A, int lda, const GEMM_T *B, int ldb,
+                      GEMM_T beta, GEMM_T *C, int ldc)
+{
+  static GEMM_T Ap[GEMM_MC_PAD * GEMM_KC] __attribute__((aligned(64)));
+  static GEMM_T Bp[GEMM_KC * GEMM_NC_PAD] __attribute__((aligned(64)));
+
+  for (int i = 0; i < m; i++)
+  {
+    for (int j = 0; j < n; j++)
+      C[i * ldc + j] *= beta;
+  }
+
+  for (int jc = 0; jc < n; jc += GEMM_NC)
+  {
+    int nc = MIN(GEMM_NC, n - jc);
+
+    for (int pc = 0; pc < k; pc += GEMM_KC)
+    {
+      int kc = MIN(GEMM_KC, k - pc);
+
+      GEMM_FN(pack_b)(kc, nc, &B[pc * ldb + jc], ldb, Bp);
+
+      for (int ic = 0; ic < m; ic += GEMM_MC)
+      {
+        int mc = MIN(GEMM_MC, m - ic);
+
+        GEMM_FN(pack_a)(mc, kc, &A[ic * lda + pc], lda, Ap);
+
+        for (int jr = 0; jr < nc; jr += GEMM_NR)
+        {
+          for (int ir = 0; ir < mc; ir += GEMM_MR)
+          {
+            GEMM_FN(micro_kernel)(kc, alpha, &Ap[ir * kc], &Bp[jr * kc],
+                                  &C[(ic + ir) * ldc + jc + jr], ldc,
+                                  MIN(GEMM_MR, mc - ir),
+                                  MIN(GEMM_NR, nc - jr));
+          }
+        }
+      }
+    }
+  }
+}
@@ -1,8 +1,20 @@
 #include "libmin.h"
 
-#define M 32
-#define N 32
-#define K 32
+/* matrix sizes, override with -DGEMM_M=<rows of A and C>, -DGEMM_N=<columns
+   of B and C>, and -DGEMM_K=<columns of A and rows of B> */
+#ifndef GEMM_M
+#define GEMM_M 32
+#endif
+#ifndef GEMM_N
+#define GEMM_N 32
+#endif
+#ifndef GEMM_K
+#define GEMM_K 32
+#endif
+
+#define M GEMM_M
+#define N GEMM_N
+#define K GEMM_K
 
 #define I_ALPHA 3
 #define I_BETA  2
@@ -60,6 +72,47 @@ init_int_matrices(void)
   }
 }
 
+#ifdef BLOCKED
+/* cache block sizes, tune to the L1/L2/L3 of the core, and micro-kernel tile
+   size, tune to the register file (GEMM_MR x GEMM_NR accumulators) */
+#ifndef GEMM_MC
+#define GEMM_MC 64
+#endif
+#ifndef GEMM_KC
+#define GEMM_KC 128
+#endif
+#ifndef GEMM_NC
+#define GEMM_NC 256
+#endif
+#ifndef GEMM_MR
+#define GEMM_MR 4
+#endif
+#ifndef GEMM_NR
+#define GEMM_NR 4
+#endif
+
+/* packed block sizes, rounded up to whole micro-panels */
+#define GEMM_MC_PAD (((GEMM_MC + GEMM_MR - 1) / GEMM_MR) * GEMM_MR)
+#define GEMM_NC_PAD (((GEMM_NC + GEMM_NR - 1) / GEMM_NR) * GEMM_NR)
+
+#define GEMM_T int64_t
+#define GEMM_FN(NAME) int_##NAME
+#include "gemm-blocked.h"
+#undef GEMM_T
+#undef GEMM_FN
+
+#define GEMM_T double
+#define GEMM_FN(NAME) fp_##NAME
+#include "gemm-blocked.h"
+#undef GEMM_T
+#undef GEMM_FN
+
+static void
+int_gemm_kernel(void)
+{
+  int_blocked_gemm(M, N, K, I_ALPHA, &IA[0][0], K, &IB[0][0], N, I_BETA, &IC[0][0], N);
+}
+#else /* !BLOCKED */
 static void
 int_gemm_kernel(void)
 {
@@ -76,6 +129,7 @@ int_gemm_kernel(void)
     }
   }
 }
+#endif /* BLOCKED */
 
 static void
 int_gemm_reference(void)
@@ -103,7 +157,9 @@ run_int_gemm(void)
 {
   init_int_matrices();
 
+  libtarg_start_perf();
   int_gemm_kernel();
+  libtarg_stop_perf();
 
   int_gemm_reference();
 
@@ -162,6 +218,13 @@ init_fp_matrices(void)
   }
 }
 
+#ifdef BLOCKED
+static void
+fp_gemm_kernel(void)
+{
+  fp_blocked_gemm(M, N, K, D_ALPHA, &DA[0][0], K, &DB[0][0], N, D_BETA, &DC[0][0], N);
+}
+#else /* !BLOCKED */
 static void
 fp_gemm_kernel(void)
 {
@@ -178,6 +241,7 @@ fp_gemm_kernel(void)
     }
   }
 }
+#endif /* BLOCKED */
 
 static void
 fp_gemm_reference(void)
@@ -205,7 +269,9 @@ run_fp_gemm(void)
 {
   init_fp_matrices();
 
+  libtarg_start_perf();
   fp_gemm_kernel();
+  libtarg_stop_perf();
 
   fp_gemm_reference();
 
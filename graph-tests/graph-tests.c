@@ -7,6 +7,25 @@
 
 #include "libmin.h"
 
+#ifdef ALLOC_ARENA
+/* all graph and list storage comes from an arena, released at once at exit */
+#define ARENA_SIZE  4096
+static uint8_t arena_buf[ARENA_SIZE];
+static libmin_arena_t arena;
+#define GRAPH_MALLOC(SZ)  libmin_arena_alloc(&arena, (SZ))
+#else /* !ALLOC_ARENA */
+#define GRAPH_MALLOC(SZ)  libmin_malloc(SZ)
+#endif /* ALLOC_ARENA */
+
+#ifdef ALLOC_POOL
+/* adjacency list nodes come from a contiguous object pool */
+#define NODE_POOL_SIZE  16
+static libmin_pool_t node_pool;
+#define NODE_MALLOC(SZ)  libmin_pool_alloc(&node_pool)
+#else /* !ALLOC_POOL */
+#define NODE_MALLOC(SZ)  GRAPH_MALLOC(SZ)
+#endif /* ALLOC_POOL */
+
 struct queue {
     int items[40];
     int front;
@@ -27,7 +46,7 @@ struct Graph{
 };
 
 struct node* createNode(int v) {
-    struct node* newNode = (struct node*)libmin_malloc(sizeof(struct node));
+    struct node* newNode = (struct node*)NODE_MALLOC(sizeof(struct node));
     newNode->vertex = v;
     newNode->next = NULL;
     return newNode;
@@ -35,11 +54,11 @@ struct node* createNode(int v) {
 
 struct Graph* createGraph(int vertices) {
     int i;
-    struct Graph* graph = (struct Graph*)libmin_malloc(sizeof(struct Graph));
+    struct Graph* graph = (struct Graph*)GRAPH_MALLOC(sizeof(struct Graph));
     graph->numVertices = vertices;
 
-    graph->adjLists = (struct node**)libmin_malloc(vertices * sizeof(struct node*));
-    graph->visited = (int*)libmin_malloc(vertices * sizeof(int));
+    graph->adjLists = (struct node**)GRAPH_MALLOC(vertices * sizeof(struct node*));
+    graph->visited = (int*)GRAPH_MALLOC(vertices * sizeof(int));
 
     for (i = 0; i < vertices; i++) {
         graph->adjLists[i] = NULL;
@@ -62,7 +81,7 @@ void addEdge(struct Graph* graph, int src, int dest) {
 }
 
 struct queue* createQueue() {
-    struct queue* q = (struct queue*)libmin_malloc(sizeof(struct queue));
+    struct queue* q = (struct queue*)GRAPH_MALLOC(sizeof(struct queue));
     q->front = -1;
     q->rear = -1;
     return q;
@@ -158,7 +177,7 @@ struct Node {
 };
 
 void insertAtTheBegin(struct Node **start_ref, int data) {
-    struct Node *ptr1 = (struct Node*)libmin_malloc(sizeof(struct Node));
+    struct Node *ptr1 = (struct Node*)GRAPH_MALLOC(sizeof(struct Node));
     ptr1->data = data;
     ptr1->next = *start_ref;
     *start_ref = ptr1;
@@ -241,7 +260,7 @@ int isStackEmpty() {
 
 
 void addVertex() {
-   struct Vertex* vertex = (struct Vertex*)libmin_malloc(sizeof(struct Vertex));
+   struct Vertex* vertex = (struct Vertex*)GRAPH_MALLOC(sizeof(struct Vertex));
    vertex->visited = FALSE;
    lstVertices[vertexCount++] = vertex;
 }
@@ -332,6 +351,13 @@ towers_test(void)
 int
 main(void)
 {
+#ifdef ALLOC_ARENA
+    libmin_arena_init(&arena, arena_buf, ARENA_SIZE);
+#endif /* ALLOC_ARENA */
+#ifdef ALLOC_POOL
+    if (!libmin_pool_init(&node_pool, sizeof(struct node), NODE_POOL_SIZE))
+        libmin_fail(1);
+#endif /* ALLOC_POOL */
 
     bfs_test();
 
@@ -341,6 +367,13 @@ main(void)
 
     towers_test();
 
+#ifdef ALLOC_ARENA
+    libmin_arena_destroy(&arena);
+#endif /* ALLOC_ARENA */
+#ifdef ALLOC_POOL
+    libmin_pool_destroy(&node_pool);
+#endif /* ALLOC_POOL */
+
     libmin_success();
     return 0;
 }
@@ -1,5 +1,10 @@
 #include "libmin.h"
 
+#ifndef HEAT_DIM
+#define HEAT_DIM 1    // 1 (rod), 2 (plate) or 3 (block)
+#endif
+
+#if HEAT_DIM == 1
 #define N      100    // Number of grid points along the rod.
 #define STEPS  500   // Number of time steps for the simulation.
 #define ALPHA  1.0    // Thermal diffusivity constant.
@@ -52,7 +57,146 @@ int main() {
     }
     libmin_printf("Checksum: %.2f\n", checksum);
 
-    libtarg_success();
+    libmin_success();
     return 0;
 }
+#else /* HEAT_DIM != 1 */
+// 2-D and 3-D Jacobi stencils on an HEAT_N^HEAT_DIM grid, a hot spot at
+// the center and a boundary fixed at 0.0. The two grids are swapped by
+// pointer after each step. The update of a point always uses the same
+// expression, so every schedule below produces the same result:
+//  - HEAT_TILE > 0 tiles the inner dimensions (x strips in 2-D, y-x blocks
+//    in 3-D) so that the rows or planes around a point stay in cache
+//  - HEAT_TBLOCK > 1 blocks HEAT_TBLOCK time steps together, by skewing the
+//    outer dimension (rows in 2-D, planes in 3-D) into a wavefront: bands of
+//    HEAT_WBLOCK rows are advanced through all steps of the block before the
+//    next band, each step one row behind the one before. Level t+1 only
+//    overwrites level t-1 where level t is complete, so two grids suffice.
+#ifndef HEAT_N
+#if HEAT_DIM == 2
+#define HEAT_N 512    // Grid points per dimension (2 MB per grid).
+#else
+#define HEAT_N 64     // Grid points per dimension (2 MB per grid).
+#endif
+#endif
+#ifndef HEAT_STEPS
+#define HEAT_STEPS 100  // Number of time steps for the simulation.
+#endif
+#ifndef HEAT_TILE
+#define HEAT_TILE 0   // Inner dimension tile size, 0 for no tiling.
+#endif
+#ifndef HEAT_TBLOCK
+#define HEAT_TBLOCK 1 // Time steps per temporal block, 1 for no blocking.
+#endif
+#ifndef HEAT_WBLOCK
+#define HEAT_WBLOCK 16  // Rows (planes) per band of a temporal block.
+#endif
+#define ALPHA  1.0    // Thermal diffusivity constant.
+#define DX     1.0    // Spatial step (distance between grid points).
+#define DT     0.1    // Time step (stable for DT*ALPHA/DX^2 <= 1/(2*HEAT_DIM)).
+
+#if HEAT_DIM == 2
+#define HEAT_POINTS (HEAT_N * HEAT_N)
+#define IDX(y, x)   ((y) * HEAT_N + (x))
+#else
+#define HEAT_POINTS (HEAT_N * HEAT_N * HEAT_N)
+#define IDX(z, y, x) (((z) * HEAT_N + (y)) * HEAT_N + (x))
+#endif
+
+static double grid_a[HEAT_POINTS];
+static double grid_b[HEAT_POINTS];
+
+// Advance the points of outer rows (planes) lo..hi-1 by one step.
+static void sweep(const double *restrict u, double *restrict u_new, int lo, int hi) {
+    const double r = DT * ALPHA / (DX * DX);
+    const int tile = HEAT_TILE > 0 ? HEAT_TILE : HEAT_N;
+#if HEAT_DIM == 2
+    for (int xt = 1; xt < HEAT_N - 1; xt += tile) {
+        int xe = MIN(xt + tile, HEAT_N - 1);
+        for (int y = lo; y < hi; y++) {
+            for (int x = xt; x < xe; x++) {
+                u_new[IDX(y, x)] = u[IDX(y, x)] + r * (u[IDX(y - 1, x)] + u[IDX(y + 1, x)]
+                    + u[IDX(y, x - 1)] + u[IDX(y, x + 1)] - 4 * u[IDX(y, x)]);
+            }
+        }
+    }
+#else
+    for (int yt = 1; yt < HEAT_N - 1; yt += tile) {
+        int ye = MIN(yt + tile, HEAT_N - 1);
+        for (int xt = 1; xt < HEAT_N - 1; xt += tile) {
+            int xe = MIN(xt + tile, HEAT_N - 1);
+            for (int z = lo; z < hi; z++) {
+                for (int y = yt; y < ye; y++) {
+                    for (int x = xt; x < xe; x++) {
+                        u_new[IDX(z, y, x)] = u[IDX(z, y, x)] + r * (u[IDX(z - 1, y, x)] + u[IDX(z + 1, y, x)]
+                            + u[IDX(z, y - 1, x)] + u[IDX(z, y + 1, x)]
+                            + u[IDX(z, y, x - 1)] + u[IDX(z, y, x + 1)] - 6 * u[IDX(z, y, x)]);
+                    }
+                }
+            }
+        }
+    }
+#endif
+}
+
+int main() {
+    double *u = grid_a, *u_new = grid_b;
 
+    // Hot spot at the center, the boundary of both grids stays at 0.0.
+#if HEAT_DIM == 2
+    u[IDX(HEAT_N / 2, HEAT_N / 2)] = 100.0;
+#else
+    u[IDX(HEAT_N / 2, HEAT_N / 2, HEAT_N / 2)] = 100.0;
+#endif
+
+    libtarg_start_perf();
+#if HEAT_TBLOCK > 1
+    for (int t0 = 0; t0 < HEAT_STEPS; t0 += HEAT_TBLOCK) {
+        int steps = MIN(HEAT_TBLOCK, HEAT_STEPS - t0);
+        for (int band = 1; ; band += HEAT_WBLOCK) {
+            int last = (band + HEAT_WBLOCK >= HEAT_N - 1);
+            for (int s = 0; s < steps; s++) {
+                int lo = MAX(1, band - s);
+                int hi = last ? HEAT_N - 1 : band + HEAT_WBLOCK - s;
+                double *src = (s % 2 == 0) ? u : u_new;
+                if (lo < hi)
+                    sweep(src, (src == u) ? u_new : u, lo, hi);
+            }
+            if (last)
+                break;
+        }
+        if (steps % 2 == 1) {
+            double *tmp = u; u = u_new; u_new = tmp;
+        }
+    }
+#else
+    for (int step = 0; step < HEAT_STEPS; step++) {
+        sweep(u, u_new, 1, HEAT_N - 1);
+        double *tmp = u; u = u_new; u_new = tmp;
+    }
+#endif
+    libtarg_stop_perf();
+
+    // Output the temperatures along the center line, and checksums over the
+    // whole grid, the second weighted to catch misplaced values.
+    libmin_printf("Temperatures along the center of a %d-D grid of %d points per side, after %d steps:\n",
+                  HEAT_DIM, HEAT_N, HEAT_STEPS);
+    for (int x = HEAT_N / 2; x < HEAT_N; x += MAX(1, HEAT_N / 32)) {
+#if HEAT_DIM == 2
+        libmin_printf("u[%d] = %.6f\n", x, u[IDX(HEAT_N / 2, x)]);
+#else
+        libmin_printf("u[%d] = %.6f\n", x, u[IDX(HEAT_N / 2, HEAT_N / 2, x)]);
+#endif
+    }
+    double checksum = 0.0, weighted = 0.0;
+    for (int i = 0; i < HEAT_POINTS; i++) {
+        checksum += u[i];
+        weighted += u[i] * (double)(i % 97 + 1);
+    }
+    libmin_printf("Checksum: %.6f\n", checksum);
+    libmin_printf("Weighted checksum: %.6f\n", weighted);
+
+    libmin_success();
+    return 0;
+}
+#endif /* HEAT_DIM */
@@ -1,13 +1,41 @@
 #include "libmin.h"
 
+#ifndef kRows
 #define kRows 20
+#endif
+#ifndef kCols
 #define kCols 20
-unsigned kIterations = 100 /* 250 */;
+#endif
+#ifndef GENERATIONS
+#define GENERATIONS 100 /* 250 */
+#endif
+#ifndef REPORT_EVERY
+#define REPORT_EVERY 25 // iterations between printed boards
+#endif
+#ifndef kSeed
+#define kSeed (kRows > kCols ? kRows : kCols) // random cells in a kSeed x kSeed corner
+#endif
+unsigned kIterations = GENERATIONS;
+
+#ifdef BITPACK
+// bit-packed board, row r holds column c in bit c % 64 of word c / 64, the
+// bits past kCols in the last word of a row are always zero
+#define kWords ((kCols + 63) / 64)
+#define kLastMask ((kCols % 64) ? ((1ULL << (kCols % 64)) - 1) : ~0ULL)
+#define CELL(board, r, c) (((board)[r][(c) / 64] >> ((c) % 64)) & 1)
+
+uint64_t board_a[kRows][kWords];
+uint64_t board_b[kRows][kWords];
+
+typedef uint64_t board_t[kRows][kWords];
+#else /* !BITPACK */
+#define CELL(board, r, c) ((board)[r][c])
 
 uint64_t board_a[kRows][kCols];
 uint64_t board_b[kRows][kCols];
 
 typedef uint64_t board_t[kRows][kCols];
+#endif /* BITPACK */
 
 inline unsigned wrap_row(int r) {
   return (unsigned)((r + (int)(kRows)) % (int)(kRows));
@@ -17,13 +45,32 @@ inline unsigned wrap_col(int c) {
   return (unsigned)((c + (int)(kCols)) % (int)(kCols));
 }
 
+#ifdef QUIET
+// large boards, print the number of alive cells and a hash of the board
+void print_board(unsigned i, board_t *board) {
+  static uint8_t row[kCols];
+  uint32_t hash = FNV32A_INIT;
+
+  unsigned alive_count = 0;
+  for (unsigned r = 0; r < kRows; ++r) {
+    for (unsigned c = 0; c < kCols; ++c) {
+      row[c] = (uint8_t)CELL(*board, r, c);
+      alive_count += row[c];
+    }
+    hash = libmin_fnv32a(row, kCols, hash);
+  }
+
+  libmin_printf("HighLife %ux%u after %u iterations: %u alive cells, hash 0x%08x\n",
+                kRows, kCols, i, alive_count, hash);
+}
+#else /* !QUIET */
 void print_board(unsigned i, board_t *board) {
   libmin_printf("HighLife %ux%u after %u iterations:\n", kRows, kCols, i);
 
   unsigned alive_count = 0;
   for (unsigned r = 0; r < kRows; ++r) {
     for (unsigned c = 0; c < kCols; ++c) {
-      const uint64_t cell = (*board)[r][c];
+      const uint64_t cell = CELL(*board, r, c);
       const char ch = cell ? '#' : '.';
       libmin_printf("%c", ch);
       alive_count += (unsigned)(cell);
@@ -33,11 +80,71 @@ void print_board(unsigned i, board_t *board) {
 
   libmin_printf("Alive cells: %u\n", alive_count);
 }
+#endif /* QUIET */
 
+#ifdef BITPACK
 void init_board() {
   for (unsigned r = 0; r < kRows; ++r) {
     for (unsigned c = 0; c < kCols; ++c) {
-      const uint64_t v = libmin_rand() & 1u;
+      const uint64_t v = (r < kSeed && c < kSeed) ? (libmin_rand() & 1u) : 0;
+      board_a[r][c / 64] |= v << (c % 64);
+    }
+  }
+}
+
+// sum of three bit vectors, bitwise: sum and carry
+#define FULL_ADD(s, c, a, b, d) \
+  do { uint64_t t_ = (a) ^ (b); (s) = t_ ^ (d); (c) = ((a) & (b)) | (t_ & (d)); } while (0)
+#define HALF_ADD(s, c, a, b) \
+  do { (s) = (a) ^ (b); (c) = (a) & (b); } while (0)
+
+// west and east neighbors of the cells of word k of a row, wrapping around
+// from column 0 to column kCols-1
+static inline uint64_t west(const uint64_t *row, unsigned k) {
+  const uint64_t in = (k > 0) ? row[k - 1] >> 63 : (row[kWords - 1] >> ((kCols - 1) % 64)) & 1;
+  return (row[k] << 1) | in;
+}
+
+static inline uint64_t east(const uint64_t *row, unsigned k) {
+  if (k < kWords - 1)
+    return (row[k] >> 1) | (row[k + 1] << 63);
+  return (row[k] >> 1) | ((row[0] & 1) << ((kCols - 1) % 64));
+}
+
+// advances 64 cells per word, the eight neighbor bits of each cell are
+// summed bitwise by a carry-save adder tree into a count modulo 8 (ones,
+// twos, fours), as a cell with 8 neighbors behaves like one with 0
+void step_highlife(board_t cur, board_t nxt) {
+  for (unsigned r = 0; r < kRows; ++r) {
+    const uint64_t *up = cur[wrap_row((int)(r) - 1)];
+    const uint64_t *mid = cur[r];
+    const uint64_t *down = cur[wrap_row((int)(r) + 1)];
+
+    for (unsigned k = 0; k < kWords; ++k) {
+      uint64_t s0, c0, s1, c1, s2, c2, ones, c3, t, c4, twos, c5;
+
+      FULL_ADD(s0, c0, west(up, k), up[k], east(up, k));
+      FULL_ADD(s1, c1, west(down, k), down[k], east(down, k));
+      HALF_ADD(s2, c2, west(mid, k), east(mid, k));
+      FULL_ADD(ones, c3, s0, s1, s2);
+      FULL_ADD(t, c4, c0, c1, c2);
+      HALF_ADD(twos, c5, t, c3);
+      const uint64_t fours = c4 ^ c5;
+
+      // survive with 2 or 3 neighbors, born with 3 or 6
+      const uint64_t survive = ~fours & twos;
+      const uint64_t born = twos & ones & ~fours;
+      const uint64_t born6 = fours & twos & ~ones;
+      const uint64_t next = (mid[k] & survive) | (~mid[k] & (born | born6));
+      nxt[r][k] = (k == kWords - 1) ? next & kLastMask : next;
+    }
+  }
+}
+#else /* !BITPACK */
+void init_board() {
+  for (unsigned r = 0; r < kRows; ++r) {
+    for (unsigned c = 0; c < kCols; ++c) {
+      const uint64_t v = (r < kSeed && c < kSeed) ? (libmin_rand() & 1u) : 0;
       board_a[r][c] = v;
       board_b[r][c] = 0;
     }
@@ -71,22 +178,318 @@ void step_highlife(board_t cur, board_t nxt) {
     }
   }
 }
+#endif /* BITPACK */
+
+#ifdef HASHLIFE
+// Hashlife: the board is a quadtree of canonical nodes shared through a hash
+// table, a node of level k is a 2^k x 2^k square, and the dead and the alive
+// cell are the two nodes of level 0. The successor of a node of level k >= 2
+// is its center square of level k-1 advanced 2^min(hl_step, k-2)
+// generations, computed from the successors of nine overlapping subsquares
+// and memoized in the node, so repeated patterns in space and in time are
+// only evaluated once.
+//
+// The board is a torus of side 2^n. Tiling 2x2 copies of it gives a node of
+// level n+1 whose center square is the board rolled by half its side, so the
+// successor of that node, rolled back, advances the board by up to 2^(n-1)
+// generations at once.
+#if (kRows != kCols) || (kRows & (kRows - 1)) || (kRows < 8)
+#error "HASHLIFE needs a square board with a power of 2 side of at least 8"
+#endif
+
+// The node pool and its hash and collection tables take 36 bytes per node.
+// The default of 4 nodes per cell, which a random board needs within one
+// step, up to 2^20 nodes, is 590 KB for a 64x64 board (BOARD=square) and
+// 38 MB for 512x512 boards and up. The sparse 1024x1024 board of BOARD=long
+// peaks at about 715K nodes, a dense board of that size needs a larger pool.
+#ifndef HL_NODES
+#define HL_NODES (kRows * kRows < (1u << 18) ? 4u * kRows * kRows : (1u << 20)) // node pool capacity, a power of 2
+#endif
+#define HL_NONE 0xffffffffu
+#define HL_MAX_LEVEL 32
+
+typedef struct {
+  uint32_t child[4]; // nw, ne, sw, se
+  uint32_t next;     // next node in the hash bucket
+  uint32_t result;   // memoized successor, HL_NONE if none
+  uint8_t level;
+  uint8_t step;      // log2 of the generations of the memoized successor
+} hl_node_t;
+
+static hl_node_t hl_nodes[HL_NODES];
+static uint32_t hl_buckets[HL_NODES];
+static uint32_t hl_forward[HL_NODES]; // new node indices while collecting
+static uint32_t hl_count;             // nodes in use, 0 and 1 are the cells
+static uint32_t hl_empty[HL_MAX_LEVEL];
+static unsigned hl_step;
+static unsigned hl_level;             // level of the board
+static unsigned hl_collections;
+
+static inline uint32_t hl_hash(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) {
+  uint32_t h = nw * 0x9e3779b1u;
+  h = (h ^ ne) * 0x85ebca6bu;
+  h = (h ^ sw) * 0xc2b2ae35u;
+  h = (h ^ se) * 0x27d4eb2fu;
+  return (h ^ (h >> 15)) & (HL_NODES - 1);
+}
+
+// the canonical node with the given quadrants
+static uint32_t hl_join(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) {
+  const uint32_t h = hl_hash(nw, ne, sw, se);
+  for (uint32_t i = hl_buckets[h]; i != HL_NONE; i = hl_nodes[i].next) {
+    const hl_node_t *n = &hl_nodes[i];
+    if (n->child[0] == nw && n->child[1] == ne && n->child[2] == sw && n->child[3] == se)
+      return i;
+  }
+  if (hl_count == HL_NODES) {
+    libmin_printf("ERROR: out of Hashlife nodes, increase HL_NODES\n");
+    libmin_fail(1);
+  }
+  hl_node_t *n = &hl_nodes[hl_count];
+  n->child[0] = nw;
+  n->child[1] = ne;
+  n->child[2] = sw;
+  n->child[3] = se;
+  n->level = hl_nodes[nw].level + 1;
+  n->result = HL_NONE;
+  n->next = hl_buckets[h];
+  hl_buckets[h] = hl_count;
+  return hl_count++;
+}
+
+#define HL_NW(n) (hl_nodes[n].child[0])
+#define HL_NE(n) (hl_nodes[n].child[1])
+#define HL_SW(n) (hl_nodes[n].child[2])
+#define HL_SE(n) (hl_nodes[n].child[3])
+
+// center square of a node, and of two nodes side by side or stacked
+static uint32_t hl_center(uint32_t n) {
+  return hl_join(HL_SE(HL_NW(n)), HL_SW(HL_NE(n)), HL_NE(HL_SW(n)), HL_NW(HL_SE(n)));
+}
 
+static uint32_t hl_horizontal(uint32_t w, uint32_t e) {
+  return hl_join(HL_NE(w), HL_NW(e), HL_SE(w), HL_SW(e));
+}
+
+static uint32_t hl_vertical(uint32_t n, uint32_t s) {
+  return hl_join(HL_SW(n), HL_SE(n), HL_NW(s), HL_NE(s));
+}
+
+// successor of a 4x4 node, its center 2x2 cells after one generation
+static uint32_t hl_base(uint32_t n) {
+  unsigned cells = 0; // bit y * 4 + x
+  for (unsigned y = 0; y < 4; ++y) {
+    for (unsigned x = 0; x < 4; ++x) {
+      const uint32_t quad = hl_nodes[n].child[(y >> 1) * 2 + (x >> 1)];
+      cells |= hl_nodes[quad].child[(y & 1) * 2 + (x & 1)] << (y * 4 + x);
+    }
+  }
+
+  uint32_t next[4];
+  for (unsigned y = 1; y < 3; ++y) {
+    for (unsigned x = 1; x < 3; ++x) {
+      unsigned count = 0;
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+          if (dy != 0 || dx != 0)
+            count += (cells >> ((y + dy) * 4 + (x + dx))) & 1;
+        }
+      }
+      const unsigned alive = (cells >> (y * 4 + x)) & 1;
+      const unsigned survive = (count == 2) | (count == 3);
+      const unsigned born = (count == 3) | /* extra highlife birth condition */(count == 6);
+      next[(y - 1) * 2 + (x - 1)] = alive ? survive : born;
+    }
+  }
+  return hl_join(next[0], next[1], next[2], next[3]);
+}
+
+static uint32_t hl_successor(uint32_t n) {
+  const unsigned k = hl_nodes[n].level;
+  const unsigned step = (hl_step < k - 2) ? hl_step : k - 2;
+  if (hl_nodes[n].result != HL_NONE && hl_nodes[n].step == step)
+    return hl_nodes[n].result;
+
+  uint32_t r;
+  if (k == 2) {
+    r = hl_base(n);
+  } else {
+    // nine overlapping squares of level k-1, advanced into level k-2
+    const uint32_t nw = HL_NW(n), ne = HL_NE(n), sw = HL_SW(n), se = HL_SE(n);
+    const uint32_t r00 = hl_successor(nw);
+    const uint32_t r01 = hl_successor(hl_horizontal(nw, ne));
+    const uint32_t r02 = hl_successor(ne);
+    const uint32_t r10 = hl_successor(hl_vertical(nw, sw));
+    const uint32_t r11 = hl_successor(hl_center(n));
+    const uint32_t r12 = hl_successor(hl_vertical(ne, se));
+    const uint32_t r20 = hl_successor(sw);
+    const uint32_t r21 = hl_successor(hl_horizontal(sw, se));
+    const uint32_t r22 = hl_successor(se);
+
+    const uint32_t q0 = hl_join(r00, r01, r10, r11);
+    const uint32_t q1 = hl_join(r01, r02, r11, r12);
+    const uint32_t q2 = hl_join(r10, r11, r20, r21);
+    const uint32_t q3 = hl_join(r11, r12, r21, r22);
+    if (step == k - 2) {
+      // the four quadrants advance as far again
+      r = hl_join(hl_successor(q0), hl_successor(q1), hl_successor(q2), hl_successor(q3));
+    } else {
+      r = hl_join(hl_center(q0), hl_center(q1), hl_center(q2), hl_center(q3));
+    }
+  }
+  hl_nodes[n].result = r;
+  hl_nodes[n].step = (uint8_t)step;
+  return r;
+}
+
+static void hl_mark(uint32_t n) {
+  if (hl_forward[n] != HL_NONE)
+    return;
+  hl_forward[n] = 0;
+  if (hl_nodes[n].level > 0) {
+    for (unsigned q = 0; q < 4; ++q)
+      hl_mark(hl_nodes[n].child[q]);
+  }
+}
+
+// drop the nodes that are not part of the board, and all memoized
+// successors, children always precede their parents in the pool, so the
+// nodes in use can slide down in place
+static uint32_t hl_collect(uint32_t root) {
+  for (uint32_t i = 0; i < hl_count; ++i)
+    hl_forward[i] = HL_NONE;
+  hl_mark(0);
+  hl_mark(1);
+  hl_mark(root);
+  for (unsigned k = 1; k <= hl_level + 1; ++k)
+    hl_mark(hl_empty[k]);
+
+  for (uint32_t i = 0; i < HL_NODES; ++i)
+    hl_buckets[i] = HL_NONE;
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < hl_count; ++i) {
+    if (hl_forward[i] == HL_NONE)
+      continue;
+    hl_node_t n = hl_nodes[i];
+    if (n.level > 0) {
+      for (unsigned q = 0; q < 4; ++q)
+        n.child[q] = hl_forward[n.child[q]];
+      const uint32_t h = hl_hash(n.child[0], n.child[1], n.child[2], n.child[3]);
+      n.next = hl_buckets[h];
+      hl_buckets[h] = count;
+    }
+    n.result = HL_NONE;
+    hl_nodes[count] = n;
+    hl_forward[i] = count++;
+  }
+  hl_count = count;
+
+  for (unsigned k = 1; k <= hl_level + 1; ++k)
+    hl_empty[k] = hl_forward[hl_empty[k]];
+  hl_collections++;
+  return hl_forward[root];
+}
+
+static void hl_init(void) {
+  for (uint32_t i = 0; i < HL_NODES; ++i)
+    hl_buckets[i] = HL_NONE;
+  hl_nodes[0].level = hl_nodes[1].level = 0;
+  hl_nodes[0].result = hl_nodes[1].result = HL_NONE;
+  hl_count = 2;
+
+  hl_level = 0;
+  while ((1u << hl_level) < kRows)
+    hl_level++;
+  hl_empty[0] = 0;
+  for (unsigned k = 1; k <= hl_level + 1; ++k)
+    hl_empty[k] = hl_join(hl_empty[k - 1], hl_empty[k - 1], hl_empty[k - 1], hl_empty[k - 1]);
+}
+
+static uint32_t hl_build(board_t board, unsigned level, unsigned r, unsigned c) {
+  if (level == 0)
+    return (uint32_t)CELL(board, r, c);
+  const unsigned h = 1u << (level - 1);
+  return hl_join(hl_build(board, level - 1, r, c), hl_build(board, level - 1, r, c + h),
+                 hl_build(board, level - 1, r + h, c), hl_build(board, level - 1, r + h, c + h));
+}
+
+static void hl_write(uint32_t n, board_t board, unsigned r, unsigned c) {
+  const unsigned level = hl_nodes[n].level;
+  if (level == 0) {
+    board[r][c / 64] |= (uint64_t)n << (c % 64);
+    return;
+  }
+  if (n == hl_empty[level])
+    return;
+  const unsigned h = 1u << (level - 1);
+  hl_write(HL_NW(n), board, r, c);
+  hl_write(HL_NE(n), board, r, c + h);
+  hl_write(HL_SW(n), board, r + h, c);
+  hl_write(HL_SE(n), board, r + h, c + h);
+}
+
+// advance the board by gens generations, in power of 2 steps
+static uint32_t hl_run(uint32_t root, unsigned gens) {
+  while (gens > 0) {
+    unsigned step = 0;
+    while (step < hl_level - 1 && (2u << step) <= gens)
+      step++;
+    hl_step = step;
+    const uint32_t r = hl_successor(hl_join(root, root, root, root));
+    root = hl_join(HL_SE(r), HL_SW(r), HL_NE(r), HL_NW(r));
+    gens -= 1u << step;
+    if (hl_count > HL_NODES / 2)
+      root = hl_collect(root);
+  }
+  return root;
+}
+
+board_t *run_simulation() {
+  hl_init();
+  uint32_t root = hl_build(board_a, hl_level, 0, 0);
+
+  libtarg_start_perf();
+  unsigned i = 0;
+  while (i < kIterations) {
+    if ((i % REPORT_EVERY) == 0) {
+      libmin_memset(board_a, 0, sizeof(board_a));
+      hl_write(root, board_a, 0, 0);
+      print_board(i, &board_a);
+    }
+    unsigned gens = REPORT_EVERY - i % REPORT_EVERY;
+    if (gens > kIterations - i)
+      gens = kIterations - i;
+    root = hl_run(root, gens);
+    i += gens;
+  }
+  libtarg_stop_perf();
+
+#ifdef HL_STATS
+  libmin_printf("Hashlife: %u nodes, %u collections\n", hl_count, hl_collections);
+#endif
+  libmin_memset(board_a, 0, sizeof(board_a));
+  hl_write(root, board_a, 0, 0);
+  return &board_a;
+}
+#else /* !HASHLIFE */
 board_t *run_simulation() {
   board_t* cur = &board_a;
   board_t* nxt = &board_b;
 
+  libtarg_start_perf();
   for (unsigned i = 0; i < kIterations; ++i) {
-    if ((i % 25) == 0)
+    if ((i % REPORT_EVERY) == 0)
       print_board(i, cur);
     step_highlife(*cur, *nxt);
     board_t* tmp = cur;
     cur = nxt;
     nxt = tmp;
   }
+  libtarg_stop_perf();
 
   return cur;
 }
+#endif /* HASHLIFE */
 
 int main(void)
 {
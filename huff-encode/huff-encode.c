@@ -2,6 +2,16 @@
 
 #define MAX_TREE_HT 256
 
+#ifdef ALLOC_ARENA
+/* Huffman tree nodes and the min-heap are allocated from an arena on the
+   target heap, and released together when encoding is done */
+#define ARENA_SIZE  4096
+static libmin_arena_t arena;
+#define TREE_MALLOC(SZ)  libmin_arena_alloc(&arena, (SZ))
+#else /* !ALLOC_ARENA */
+#define TREE_MALLOC(SZ)  libmin_malloc(SZ)
+#endif /* ALLOC_ARENA */
+
 // Huffman tree node
 typedef struct HuffmanNode {
     char data;                // Stored character (for leaf nodes)
@@ -19,7 +29,7 @@ typedef struct {
 
 // Function to create a new Huffman node
 HuffmanNode* createNode(char data, int freq) {
-    HuffmanNode* node = (HuffmanNode*)libmin_malloc(sizeof(HuffmanNode));
+    HuffmanNode* node = (HuffmanNode*)TREE_MALLOC(sizeof(HuffmanNode));
     node->data = data;
     node->freq = freq;
     node->left = node->right = NULL;
@@ -28,10 +38,10 @@ HuffmanNode* createNode(char data, int freq) {
 
 // Function to create a min-heap of given capacity
 MinHeap* createMinHeap(int capacity) {
-    MinHeap* minHeap = (MinHeap*)libmin_malloc(sizeof(MinHeap));
+    MinHeap* minHeap = (MinHeap*)TREE_MALLOC(sizeof(MinHeap));
     minHeap->size = 0;
     minHeap->capacity = capacity;
-    minHeap->array = (HuffmanNode**)libmin_malloc(capacity * sizeof(HuffmanNode*));
+    minHeap->array = (HuffmanNode**)TREE_MALLOC(capacity * sizeof(HuffmanNode*));
     return minHeap;
 }
 
@@ -166,6 +176,11 @@ void decodeString(HuffmanNode* root, const char* encoded, char* decoded) {
 }
 
 int main() {
+#ifdef ALLOC_ARENA
+    if (!libmin_arena_create(&arena, ARENA_SIZE))
+        libmin_fail(1);
+#endif /* ALLOC_ARENA */
+
     // Example input string to compress
     char input[] = "this is an example for huffman encoding";
     
@@ -238,6 +253,9 @@ int main() {
     libmin_free(frequencies);
     
     // Note: In a complete implementation you should also free the Huffman tree nodes.
+#ifdef ALLOC_ARENA
+    libmin_arena_destroy(&arena);
+#endif /* ALLOC_ARENA */
 
     libmin_success();    
     return 0;
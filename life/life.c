@@ -18,8 +18,15 @@ char getDownRight(int x, int y);
 void sleep(unsigned int mseconds);
 
 #define MS_DELAY	1
+#ifndef GRID_WIDTH
 #define GRID_WIDTH	70
+#endif
+#ifndef GRID_HEIGHT
 #define GRID_HEIGHT	22
+#endif
+#ifndef GENERATIONS
+#define GENERATIONS	10
+#endif
 
 int NUM_BLOCKS = 2;
 char LIVE = '*';
@@ -28,6 +35,18 @@ char BLOCKS[2] = { ' ', '*' };
 
 unsigned int evolution = 1;
 
+#ifdef BITPACK
+// bit-packed grid, row y holds cell x in bit x % 64 of word x / 64, the bits
+// past GRID_WIDTH in the last word of a row are always zero
+#define GRID_WORDS	((GRID_WIDTH + 63) / 64)
+#define LAST_MASK	((GRID_WIDTH % 64) ? ((1ULL << (GRID_WIDTH % 64)) - 1) : ~0ULL)
+
+uint64_t bitVals[GRID_HEIGHT][GRID_WORDS];
+uint64_t bitTmpVals[GRID_HEIGHT][GRID_WORDS];
+
+uint64_t (*bits)[GRID_WORDS] = bitVals;
+uint64_t (*bitsTmp)[GRID_WORDS] = bitTmpVals;
+#else /* !BITPACK */
 char *gridRoots[GRID_WIDTH];
 char *gridTmpRoots[GRID_WIDTH];
 
@@ -36,6 +55,10 @@ char **gridTmp = gridTmpRoots;
 
 char gridVals[GRID_WIDTH][GRID_HEIGHT];
 char gridTmpVals[GRID_WIDTH][GRID_HEIGHT];
+#endif /* BITPACK */
+
+int isLive(int x, int y);
+void report(void);
 
 int
 main(void)
@@ -43,21 +66,161 @@ main(void)
   int iters = 0;
 
   init();
+#ifdef QUIET
+  // large boards, only report the final board
+  libtarg_start_perf();
+  for (iters = 0; iters < GENERATIONS; iters++)
+    process();
+  libtarg_stop_perf();
+  report();
+#else /* !QUIET */
   int running = TRUE;
   while (running) {
     draw();
     //sleep(500);
     process();
     iters++;
-    if (iters == 10 /*80*/)
+    if (iters == GENERATIONS /*80*/)
       running = FALSE;
   }
+#endif /* QUIET */
 
   libmin_success();
   return 0;
 }
 
 
+void
+report(void)
+{
+  static char row[GRID_WIDTH];
+  uint32_t hash = FNV32A_INIT;
+  int live = 0;
+
+  for (int y = 0; y < GRID_HEIGHT; ++y)
+    {
+      for (int x = 0; x < GRID_WIDTH; ++x)
+        {
+          row[x] = isLive(x, y);
+          live += row[x];
+        }
+      hash = libmin_fnv32a(row, GRID_WIDTH, hash);
+    }
+  libmin_printf("CONWAY'S Game of Life, %dx%d after %d evolutions\n",
+                GRID_WIDTH, GRID_HEIGHT, GENERATIONS);
+  libmin_printf("Live cells: %d, hash: 0x%08x\n", live, hash);
+}
+
+#ifdef BITPACK
+// draws the same random board as the char grid engine, column by column
+void
+init(void)
+{
+  libmin_srand(1001);
+  for (int x = 0; x < GRID_WIDTH; ++x)
+    {
+      for (int y = 0; y < GRID_HEIGHT; ++y)
+        {
+          if (BLOCKS[libmin_rand() % NUM_BLOCKS] == LIVE)
+            bits[y][x / 64] |= 1ULL << (x % 64);
+        }
+    }
+
+#ifndef QUIET
+  // clear the screen
+  libmin_printf("\x1b[2J");
+#endif
+}
+
+int
+isLive(int x, int y)
+{
+  return (bits[y][x / 64] >> (x % 64)) & 1;
+}
+
+void
+draw(void)
+{
+  // go to home position on screen
+  libmin_printf("\x1b[H");
+
+  libmin_printf("CONWAY'S Game of Life\n\nEvolution #%d\n\n", evolution++);
+  for (int y = 0; y < GRID_HEIGHT; ++y)
+    {
+      for (int x = 0; x < GRID_WIDTH; ++x)
+        libmin_printf("%c", isLive(x, y) ? LIVE : DEAD);
+      libmin_printf("\n");
+    }
+}
+
+// sum of three bit vectors, bitwise: sum and carry
+#define FULL_ADD(s, c, a, b, d) \
+  do { uint64_t t_ = (a) ^ (b); (s) = t_ ^ (d); (c) = ((a) & (b)) | (t_ & (d)); } while (0)
+#define HALF_ADD(s, c, a, b) \
+  do { (s) = (a) ^ (b); (c) = (a) & (b); } while (0)
+
+// west and east neighbors of the cells of word k of a row, the cells past
+// the edges of the board are dead
+static inline uint64_t
+west(const uint64_t *row, int k)
+{
+  return (row[k] << 1) | (k > 0 ? row[k - 1] >> 63 : 0);
+}
+
+static inline uint64_t
+east(const uint64_t *row, int k)
+{
+  return (row[k] >> 1) | (k < GRID_WORDS - 1 ? row[k + 1] << 63 : 0);
+}
+
+// advances 64 cells per word, the eight neighbor bits of each cell are
+// summed bitwise by a carry-save adder tree into a count modulo 8 (ones,
+// twos, fours), as a cell with 8 neighbors dies like one with 0
+void
+process(void)
+{
+  static const uint64_t deadRow[GRID_WORDS];
+
+  for (int y = 0; y < GRID_HEIGHT; ++y)
+    {
+      const uint64_t *up = (y > 0) ? bits[y - 1] : deadRow;
+      const uint64_t *mid = bits[y];
+      const uint64_t *down = (y < GRID_HEIGHT - 1) ? bits[y + 1] : deadRow;
+
+      for (int k = 0; k < GRID_WORDS; ++k)
+        {
+          uint64_t s0, c0, s1, c1, s2, c2, ones, c3, t, c4, twos, c5;
+
+          FULL_ADD(s0, c0, west(up, k), up[k], east(up, k));
+          FULL_ADD(s1, c1, west(down, k), down[k], east(down, k));
+          HALF_ADD(s2, c2, west(mid, k), east(mid, k));
+          FULL_ADD(ones, c3, s0, s1, s2);
+          FULL_ADD(t, c4, c0, c1, c2);
+          HALF_ADD(twos, c5, t, c3);
+          uint64_t fours = c4 ^ c5;
+
+          // 3 neighbors, or 2 neighbors and alive
+          uint64_t next = ~fours & twos & (ones | mid[k]);
+          bitsTmp[y][k] = (k == GRID_WORDS - 1) ? next & LAST_MASK : next;
+        }
+    }
+  flip();
+}
+
+void
+flip(void)
+{
+  uint64_t (*tmp)[GRID_WORDS] = bits;
+  bits = bitsTmp;
+  bitsTmp = tmp;
+}
+#else /* !BITPACK */
+int
+isLive(int x, int y)
+{
+  return grid[x][y] == LIVE;
+}
+
 void
 init(void)
 { 
@@ -73,8 +236,10 @@ init(void)
         }
     }
 
+#ifndef QUIET
   // clear the screen
   libmin_printf("\x1b[2J");
+#endif
 }
 
 void
@@ -273,6 +438,8 @@ getDownRight(int x, int y)
   return retval;
 }
 
+#endif /* BITPACK */
+
 volatile int x;
 
 void
@@ -11,6 +11,183 @@
 
 #include "libmin.h"
 
+#ifdef TILED
+/* Tiled renderer: the escape-time iteration counts of an XRES x YRES image
+   are rendered into a buffer, MB_TILE x MB_TILE pixels at a time, and only a
+   checksum of the buffer is printed. Tiles are dealt round-robin to
+   NUM_WORKERS workers; tiles share no state, so each worker may run on its own
+   hart or thread. Points in the main cardioid and the period-2 bulb are
+   rejected without iterating, and the other points use Brent-style
+   periodicity checking, so most of the set interior costs less than
+   MB_ITERMAX iterations. Neither changes the image. */
+
+#ifndef XRES
+#define XRES          640   /* horizontal resolution */
+#endif
+#ifndef YRES
+#define YRES          480   /* vertical resolution */
+#endif
+#ifndef MB_ITERMAX
+#define MB_ITERMAX    1000  /* iterations before a point is in the set */
+#endif
+#ifndef MB_TILE
+#define MB_TILE       32    /* tile side, in pixels */
+#endif
+#ifndef NUM_WORKERS
+#define NUM_WORKERS   1     /* workers (harts/threads) the tiles are dealt to */
+#endif
+
+#define TILES_X       ((XRES + MB_TILE - 1) / MB_TILE)
+#define TILES_Y       ((YRES + MB_TILE - 1) / MB_TILE)
+#define NUM_TILES     (TILES_X * TILES_Y)
+
+/* view, centered on -0.7 + 0i and 3.0 wide, as the ASCII image */
+#define MB_CENTER_X   (-0.7)
+#define MB_CENTER_Y   0.0
+#define MB_WIDTH      3.0
+
+/* iteration counts, MB_ITERMAX for points in the set */
+static uint16_t image[YRES * XRES];
+
+/* iterations performed, per tile */
+static uint32_t tile_work[NUM_TILES];
+
+/* the escape time of c = cx + i cy, adds the iterations performed to *work */
+static int
+escape(double cx, double cy, uint32_t *work)
+{
+#ifndef MB_NOCHECK
+  /* main cardioid and period-2 bulb */
+  double xq = cx - 0.25;
+  double q = xq * xq + cy * cy;
+  if (q * (q + xq) <= 0.25 * cy * cy
+      || (cx + 1.0) * (cx + 1.0) + cy * cy <= 0.0625)
+    return MB_ITERMAX;
+#endif /* !MB_NOCHECK */
+
+  double x = 0.0, y = 0.0, x2 = 0.0, y2 = 0.0;
+#ifndef MB_NOCHECK
+  /* z is saved every 2^k iterations, an orbit that returns exactly to the
+     saved point is periodic and never escapes */
+  double sx = 0.0, sy = 0.0;
+  int period = 8, next = 8;
+#endif /* !MB_NOCHECK */
+  int n;
+
+  for (n = 0; n < MB_ITERMAX; n++)
+  {
+    if (x2 + y2 > 4.0)
+      break;
+    y = 2.0 * x * y + cy;
+    x = x2 - y2 + cx;
+    x2 = x * x;
+    y2 = y * y;
+#ifndef MB_NOCHECK
+    if (x == sx && y == sy)
+    {
+      *work += n + 1;
+      return MB_ITERMAX;
+    }
+    if (n == next)
+    {
+      sx = x;
+      sy = y;
+      period *= 2;
+      next += period;
+    }
+#endif /* !MB_NOCHECK */
+  }
+  *work += n;
+  return n;
+}
+
+/* render tile TILE into the image */
+static void
+render_tile(int tile)
+{
+  const double scale = MB_WIDTH / XRES;
+  const double x0 = MB_CENTER_X - 0.5 * XRES * scale;
+  const double y0 = MB_CENTER_Y - 0.5 * YRES * scale;
+  int tx = (tile % TILES_X) * MB_TILE;
+  int ty = (tile / TILES_X) * MB_TILE;
+  uint32_t work = 0;
+
+  for (int hy = ty; hy < MIN(ty + MB_TILE, YRES); hy++)
+  {
+    double cy = y0 + (hy + 0.5) * scale;
+    for (int hx = tx; hx < MIN(tx + MB_TILE, XRES); hx++)
+      image[hy * XRES + hx] = escape(x0 + (hx + 0.5) * scale, cy, &work);
+  }
+  tile_work[tile] = work;
+}
+
+/* render the tiles dealt round-robin to worker WORKER, returns the
+   iterations performed */
+static uint64_t
+run_worker(int worker)
+{
+  uint64_t work = 0;
+  for (int tile = worker; tile < NUM_TILES; tile += NUM_WORKERS)
+  {
+    render_tile(tile);
+    work += tile_work[tile];
+  }
+  return work;
+}
+
+int
+main(void)
+{
+  uint64_t total_work = 0;
+
+  libmin_printf("** Mandelbrot %dx%d, %d iterations, %dx%d tiles\n",
+                XRES, YRES, MB_ITERMAX, MB_TILE, MB_TILE);
+
+  libtarg_start_perf();
+  for (int worker = 0; worker < NUM_WORKERS; worker++)
+  {
+    uint64_t work = run_worker(worker);
+#ifdef MB_STATS
+    libmin_printf("worker %d: %llu iterations\n", worker,
+                  (unsigned long long)work);
+#endif
+    total_work += work;
+  }
+  libtarg_stop_perf();
+
+#ifdef MB_STATS
+  uint32_t min_work = tile_work[0], max_work = tile_work[0];
+  for (int tile = 1; tile < NUM_TILES; tile++)
+  {
+    min_work = MIN(min_work, tile_work[tile]);
+    max_work = MAX(max_work, tile_work[tile]);
+  }
+  libmin_printf("tiles: %d, iterations per tile: min %u, mean %llu, max %u\n",
+                NUM_TILES, min_work,
+                (unsigned long long)(total_work / NUM_TILES), max_work);
+#else /* !MB_STATS */
+  (void)total_work;
+#endif /* MB_STATS */
+
+  /* the image, independent of the tiling, workers and rejection tests */
+  uint64_t escaped = 0, inside = 0;
+  for (int i = 0; i < XRES * YRES; i++)
+  {
+    if (image[i] == MB_ITERMAX)
+      inside++;
+    else
+      escaped += image[i];
+  }
+  libmin_printf("** points in the set: %llu\n", (unsigned long long)inside);
+  libmin_printf("** iterations of escaped points: %llu\n",
+                (unsigned long long)escaped);
+  libmin_printf("** image checksum: 0x%08x\n",
+                libmin_fnv32a(image, sizeof(image), FNV32A_INIT));
+
+  libmin_success();
+  return 0;
+}
+#else /* !TILED */
 void
 color(int red, int green, int blue)
 {
@@ -58,3 +235,4 @@ main(void)
   libmin_success();
   return 0;
 }
+#endif /* TILED */
@@ -2,6 +2,174 @@
 
 #define N 64  // Matrix dimension (adjust for more cache stress)
 
+#ifdef SWEEP
+// Memory hierarchy characterization: every variant of the multiplication is
+// timed with the perf hooks, for matrix sizes from L1-resident up to
+// SWEEP_MAX_N, and checked against the reference result. The default of 256
+// (256 KB per matrix) is L2-resident on most cores, SWEEP_MAX_N=2048 (16 MB
+// per matrix) makes the largest sizes DRAM-resident. Elements and sums are
+// uint32_t, which wraps modulo 2^32 for large sizes, so every variant still
+// computes exactly the same result. The variants are the six loop orders,
+// the (i, k, j) order over square tiles, for a sweep of tile sizes, and the
+// (i, j, k) order over a transposed copy of B, which makes the inner loop a
+// unit-stride dot product.
+
+#ifndef SWEEP_MAX_N
+#define SWEEP_MAX_N 256  // Largest matrix dimension of the sweep
+#endif
+#ifndef SWEEP_MAX_TILE
+#define SWEEP_MAX_TILE 64  // Largest tile size of the sweep
+#endif
+
+static uint32_t SA[SWEEP_MAX_N * SWEEP_MAX_N];
+static uint32_t SB[SWEEP_MAX_N * SWEEP_MAX_N];
+static uint32_t SBt[SWEEP_MAX_N * SWEEP_MAX_N];
+static uint32_t SC[SWEEP_MAX_N * SWEEP_MAX_N];
+static uint32_t SrefC[SWEEP_MAX_N * SWEEP_MAX_N];
+
+// Loop orders, named outermost loop first.
+static void mm_ijk(int n) {
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            for (int k = 0; k < n; k++)
+                SC[i * n + j] += SA[i * n + k] * SB[k * n + j];
+}
+
+static void mm_ikj(int n) {
+    for (int i = 0; i < n; i++)
+        for (int k = 0; k < n; k++)
+            for (int j = 0; j < n; j++)
+                SC[i * n + j] += SA[i * n + k] * SB[k * n + j];
+}
+
+static void mm_jik(int n) {
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            for (int k = 0; k < n; k++)
+                SC[i * n + j] += SA[i * n + k] * SB[k * n + j];
+}
+
+static void mm_jki(int n) {
+    for (int j = 0; j < n; j++)
+        for (int k = 0; k < n; k++)
+            for (int i = 0; i < n; i++)
+                SC[i * n + j] += SA[i * n + k] * SB[k * n + j];
+}
+
+static void mm_kij(int n) {
+    for (int k = 0; k < n; k++)
+        for (int i = 0; i < n; i++)
+            for (int j = 0; j < n; j++)
+                SC[i * n + j] += SA[i * n + k] * SB[k * n + j];
+}
+
+static void mm_kji(int n) {
+    for (int k = 0; k < n; k++)
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < n; i++)
+                SC[i * n + j] += SA[i * n + k] * SB[k * n + j];
+}
+
+// (i, k, j) order over t x t tiles, n must be a multiple of t.
+static void mm_tiled(int n, int t) {
+    for (int ii = 0; ii < n; ii += t)
+        for (int kk = 0; kk < n; kk += t)
+            for (int jj = 0; jj < n; jj += t)
+                for (int i = ii; i < ii + t; i++)
+                    for (int k = kk; k < kk + t; k++) {
+                        uint32_t a = SA[i * n + k];
+                        for (int j = jj; j < jj + t; j++)
+                            SC[i * n + j] += a * SB[k * n + j];
+                    }
+}
+
+// (i, j, k) order over a transposed copy of B, the transpose is timed too.
+static void mm_transposed(int n) {
+    for (int k = 0; k < n; k++)
+        for (int j = 0; j < n; j++)
+            SBt[j * n + k] = SB[k * n + j];
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) {
+            uint32_t acc = 0;
+            for (int k = 0; k < n; k++)
+                acc += SA[i * n + k] * SBt[j * n + k];
+            SC[i * n + j] = acc;
+        }
+}
+
+// Time one variant (tile size t, or 0 for the loop orders) at size n, and
+// check its result against the reference. The variant is named before it
+// runs, so its perf report follows the name.
+static int run_variant(const char *name, void (*mm)(int), int n, int t) {
+    libmin_memset(SC, 0, n * n * sizeof(SC[0]));
+    if (t)
+        libmin_printf("  %s t=%d\n", name, t);
+    else
+        libmin_printf("  %s\n", name);
+
+    libtarg_start_perf();
+    if (t)
+        mm_tiled(n, t);
+    else
+        mm(n);
+    libtarg_stop_perf();
+
+    for (int i = 0; i < n * n; i++) {
+        if (SC[i] != SrefC[i]) {
+            libmin_printf("Mismatch at (%d, %d): computed %u, expected %u\n",
+                          i / n, i % n, SC[i], SrefC[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main() {
+    static const struct {
+        const char *name;
+        void (*mm)(int);
+    } orders[] = {
+        { "ijk", mm_ijk }, { "ikj", mm_ikj }, { "jik", mm_jik },
+        { "jki", mm_jki }, { "kij", mm_kij }, { "kji", mm_kji },
+        { "transposed-B ijk", mm_transposed }
+    };
+    int error = 0;
+
+    for (int n = 16; n <= SWEEP_MAX_N && !error; n *= 2) {
+        // Initialize A and B as in the fixed-size test, and compute the
+        // reference.
+        libmin_srand(12345);
+        for (int i = 0; i < n * n; i++) {
+            SA[i] = libmin_rand() % 1000;
+            SB[i] = libmin_rand() % 1000;
+            SrefC[i] = 0;
+        }
+        for (int i = 0; i < n; i++)
+            for (int k = 0; k < n; k++)
+                for (int j = 0; j < n; j++)
+                    SrefC[i * n + j] += SA[i * n + k] * SB[k * n + j];
+
+        uint32_t checksum = 0;
+        for (int i = 0; i < n * n; i++)
+            checksum = (checksum + SrefC[i] % 100000) % 100000;
+        libmin_printf("N=%d (%d KB per matrix), checksum: %u\n",
+                      n, (int)(n * n * sizeof(SA[0]) / 1024), checksum);
+
+        for (int v = 0; v < sizeof(orders) / sizeof(orders[0]) && !error; v++)
+            error = run_variant(orders[v].name, orders[v].mm, n, 0);
+        for (int t = 4; t <= SWEEP_MAX_TILE && t <= n && !error; t *= 2)
+            error = run_variant("tiled ikj", NULL, n, t);
+        if (!error)
+            libmin_printf("N=%d: all variants verified\n", n);
+    }
+
+    if (error)
+        libtarg_fail(1);
+    libmin_success();
+    return 0;
+}
+#else /* !SWEEP */
+
 static int A[N][N];
 static int B[N][N];
 static int C[N][N];      // Result from main multiplication (order: i, j, k)
@@ -75,8 +243,9 @@ int main() {
             libmin_printf("\n");
         }
         
-        libtarg_success();
+        libmin_success();
     }
     return 0;
 }
+#endif /* SWEEP */
 
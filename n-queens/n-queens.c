@@ -1,9 +1,106 @@
 #include "libmin.h"
 
+#ifndef BOARD_SIZE
 #define BOARD_SIZE 10  // You can change this to any board size (e.g., 4, 8, 12)
+#endif
 
 int solution_count = 0;
 
+#ifdef BITMASK
+// Bitmask solver: the columns and both diagonals attacked by the queens placed
+// so far are kept as bitmasks, shifted by one column per row for diagonals, so
+// the free squares of a row are found with a few logical operations, and are
+// visited lowest set bit first.
+
+#ifndef SPLIT_ROWS
+#define SPLIT_ROWS 2   // rows placed up front to split the search into subproblems
+#endif
+#ifndef NUM_WORKERS
+#define NUM_WORKERS 1  // workers (harts/threads) the subproblems are dealt to
+#endif
+
+#if SPLIT_ROWS > 4
+#error "SPLIT_ROWS must be at most 4"
+#endif
+
+#define ALL_COLS ((1u << BOARD_SIZE) - 1)
+// at most BOARD_SIZE - k free columns in row k, so the number of subproblems
+// is bounded by BOARD_SIZE * (BOARD_SIZE - 1) * ... over the first SPLIT_ROWS rows
+#define SPLIT_COLS(k) ((k) < SPLIT_ROWS && (k) < BOARD_SIZE ? BOARD_SIZE - (k) : 1)
+#define MAX_TASKS (SPLIT_COLS(0) * SPLIT_COLS(1) * SPLIT_COLS(2) * SPLIT_COLS(3))
+
+// an independent subproblem, the state after the first SPLIT_ROWS rows
+typedef struct {
+  int row;
+  unsigned cols, diag, anti;
+} task_t;
+
+task_t tasks[MAX_TASKS];
+int num_tasks = 0;
+
+// known solution counts, used to verify the result
+const int known_solutions[] = {
+  1, 1, 0, 0, 2, 10, 4, 40, 92, 352, 724, 2680, 14200, 73712, 365596,
+  2279184, 14772512, 95815104
+};
+
+// Count the solutions below a partial placement
+int
+solve_bits(int row, unsigned cols, unsigned diag, unsigned anti)
+{
+  if (row == BOARD_SIZE)
+    return 1;
+
+  int count = 0;
+  unsigned avail = ALL_COLS & ~(cols | diag | anti);
+  while (avail)
+  {
+    unsigned bit = avail & -avail;
+    avail ^= bit;
+    count += solve_bits(row + 1, cols | bit, (diag | bit) << 1, (anti | bit) >> 1);
+  }
+  return count;
+}
+
+// Enumerate the placements of the first SPLIT_ROWS rows as subproblems
+void
+split_tasks(int row, unsigned cols, unsigned diag, unsigned anti)
+{
+  if (row == SPLIT_ROWS || row == BOARD_SIZE)
+  {
+    if (num_tasks == MAX_TASKS)
+    {
+      libmin_printf("ERROR: more than %d subproblems\n", MAX_TASKS);
+      libmin_fail(1);
+    }
+    task_t *t = &tasks[num_tasks++];
+    t->row = row;
+    t->cols = cols;
+    t->diag = diag;
+    t->anti = anti;
+    return;
+  }
+
+  unsigned avail = ALL_COLS & ~(cols | diag | anti);
+  while (avail)
+  {
+    unsigned bit = avail & -avail;
+    avail ^= bit;
+    split_tasks(row + 1, cols | bit, (diag | bit) << 1, (anti | bit) >> 1);
+  }
+}
+
+// Solve the subproblems dealt round-robin to worker WORKER, subproblems share
+// no state, so each worker may run on its own hart or thread
+int
+run_worker(int worker)
+{
+  int count = 0;
+  for (int i = worker; i < num_tasks; i += NUM_WORKERS)
+    count += solve_bits(tasks[i].row, tasks[i].cols, tasks[i].diag, tasks[i].anti);
+  return count;
+}
+#else /* !BITMASK */
 // Check if placing a queen at (row, col) is safe
 int
 is_safe(int queens[], int row, int col)
@@ -36,9 +133,31 @@ solve(int queens[], int row)
   }
 }
 
+#endif /* BITMASK */
+
 int
 main(void)
 {
+#ifdef BITMASK
+  split_tasks(0, 0, 0, 0);
+  for (int worker = 0; worker < NUM_WORKERS; worker++)
+  {
+    int count = run_worker(worker);
+#ifdef NQ_STATS
+    libmin_printf("worker %d: %d solutions\n", worker, count);
+#endif
+    solution_count += count;
+  }
+
+  libmin_printf("Total solutions for %d-Queens: %d\n", BOARD_SIZE, solution_count);
+
+  if (BOARD_SIZE < sizeof(known_solutions) / sizeof(known_solutions[0])
+      && solution_count != known_solutions[BOARD_SIZE])
+  {
+    libmin_printf("ERROR: expected %d solutions\n", known_solutions[BOARD_SIZE]);
+    libmin_fail(1);
+  }
+#else /* !BITMASK */
   int *queens = (int *)libmin_malloc(BOARD_SIZE * sizeof(int));
 
   solve(queens, 0);
@@ -46,6 +165,7 @@ main(void)
   libmin_printf("Total solutions for %d-Queens: %d\n", BOARD_SIZE, solution_count);
 
   libmin_free(queens);
+#endif /* BITMASK */
 
   libmin_success();
   return 0;
@@ -8,6 +8,348 @@
 #define EPS 1e-9        // Softening factor to avoid singularities
 #endif
 
+#if defined(NB_SOA) || defined(NB_BH)
+/*
+ * Large simulations of NB_BODIES bodies in a uniform sphere, in units where
+ * G = 1 and the total mass is 1, integrated with kick-drift-kick leapfrog.
+ * Accelerations come from a structure-of-arrays direct summation (NB_SOA),
+ * or from a Barnes-Hut octree (NB_BH). The final state depends on the
+ * rounding of each target, so instead of printing it, the run checks that
+ * the total energy is conserved to within NB_ETOL and the total momentum to
+ * within NB_PTOL. A correct kernel drifts by about 5e-9 (SoA) or 1e-6
+ * (Barnes-Hut) in energy over the default run, a kernel with no forces or
+ * flipped forces by 4e-5 or more, and a 1% error in the forces moves the
+ * energy by about 3e-6. The SoA pair forces are exactly antisymmetric, so
+ * its momentum only changes by rounding in the force and momentum sums,
+ * at most about 3e-13 relative to sum(m |v|) (measured 3e-17 with or without
+ * FMA contraction or vectorization). NB_PTOL leaves a wide margin for
+ * targets whose double arithmetic is not correctly rounded, while a force
+ * asymmetry of 1e-9 or more still exceeds it.
+ */
+#ifndef NB_BODIES
+#ifdef NB_BH
+#define NB_BODIES 4096  // Number of particles
+#else
+#define NB_BODIES 1024
+#endif
+#endif
+#ifndef NB_STEPS
+#define NB_STEPS 20     // Number of simulation steps
+#endif
+#ifndef NB_DT
+#define NB_DT 1e-3      // Time step
+#endif
+#ifndef NB_SOFT
+#define NB_SOFT 1e-2    // Softening length
+#endif
+#ifndef NB_ETOL
+#ifdef NB_BH
+#define NB_ETOL 1e-5    // Maximum relative energy error
+#else
+#define NB_ETOL 1e-7
+#endif
+#endif
+#ifndef NB_PTOL
+#ifdef NB_BH
+#define NB_PTOL 1e-4    // Maximum momentum change, relative to sum(m |v|)
+#else
+#define NB_PTOL 1e-10
+#endif
+#endif
+#ifndef NB_TILE
+#define NB_TILE 256     // Bodies per tile of the direct kernel
+#endif
+#ifndef THETA
+#define THETA 0.5       // Barnes-Hut opening angle, cell size / distance
+#endif
+#define NB_MAXCELLS (8*NB_BODIES)
+#define NB_MAXDEPTH 48
+
+static double px[NB_BODIES], py[NB_BODIES], pz[NB_BODIES];
+static double vx[NB_BODIES], vy[NB_BODIES], vz[NB_BODIES];
+static double ax[NB_BODIES], ay[NB_BODIES], az[NB_BODIES];
+static double mass[NB_BODIES];
+
+static uint32_t nb_seed = 42;
+static double nb_urand(void) {
+    nb_seed = nb_seed * 1664525u + 1013904223u;
+    return (double)(nb_seed >> 8) / 16777216.0;
+}
+
+// 1/sqrt(x) from an estimate of the exponent and four Newton steps, in plain
+// arithmetic so that loops using it vectorize (libmin_sqrt() is a call)
+static inline double nb_rsqrt(double x) {
+    union { double d; uint64_t u; } v = { x };
+    v.u = 0x5fe6eb50c7b537a9ULL - (v.u >> 1);
+    double y = v.d;
+    y = y * (1.5 - 0.5 * x * y * y);
+    y = y * (1.5 - 0.5 * x * y * y);
+    y = y * (1.5 - 0.5 * x * y * y);
+    y = y * (1.5 - 0.5 * x * y * y);
+    return y;
+}
+
+static void nb_init(void) {
+    // positions uniform in the unit sphere, small random velocities
+    for (int i = 0; i < NB_BODIES; i++) {
+        double x, y, z;
+        do {
+            x = 2.0 * nb_urand() - 1.0;
+            y = 2.0 * nb_urand() - 1.0;
+            z = 2.0 * nb_urand() - 1.0;
+        } while (x * x + y * y + z * z > 1.0);
+        px[i] = x; py[i] = y; pz[i] = z;
+        vx[i] = 0.5 * (nb_urand() - 0.5);
+        vy[i] = 0.5 * (nb_urand() - 0.5);
+        vz[i] = 0.5 * (nb_urand() - 0.5);
+        mass[i] = 1.0 / NB_BODIES;
+    }
+}
+
+// total kinetic plus (softened) potential energy, by direct summation
+static double nb_energy(void) {
+    double kin = 0.0, pot = 0.0;
+    for (int i = 0; i < NB_BODIES; i++) {
+        kin += 0.5 * mass[i] * (vx[i] * vx[i] + vy[i] * vy[i] + vz[i] * vz[i]);
+        for (int j = i + 1; j < NB_BODIES; j++) {
+            double dx = px[j] - px[i], dy = py[j] - py[i], dz = pz[j] - pz[i];
+            pot -= mass[i] * mass[j] * nb_rsqrt(dx * dx + dy * dy + dz * dz + NB_SOFT * NB_SOFT);
+        }
+    }
+    return kin + pot;
+}
+
+// total momentum, and the sum of m |v| as its scale
+static double nb_momentum(double p[3]) {
+    double scale = 0.0;
+    p[0] = p[1] = p[2] = 0.0;
+    for (int i = 0; i < NB_BODIES; i++) {
+        p[0] += mass[i] * vx[i];
+        p[1] += mass[i] * vy[i];
+        p[2] += mass[i] * vz[i];
+        scale += mass[i] * libmin_sqrt(vx[i] * vx[i] + vy[i] * vy[i] + vz[i] * vz[i]);
+    }
+    return scale;
+}
+
+#ifdef NB_SOA
+// direct summation, the inner loop runs over a tile of bodies i with unit
+// stride and no branches (the self term has dx = dy = dz = 0), so it
+// vectorizes, and each a[i] still sums over j in order
+static void nb_accel(void) {
+    for (int i = 0; i < NB_BODIES; i++)
+        ax[i] = ay[i] = az[i] = 0.0;
+
+    for (int ib = 0; ib < NB_BODIES; ib += NB_TILE) {
+        int ie = MIN(ib + NB_TILE, NB_BODIES);
+        for (int j = 0; j < NB_BODIES; j++) {
+            double xj = px[j], yj = py[j], zj = pz[j], mj = mass[j];
+            for (int i = ib; i < ie; i++) {
+                double dx = xj - px[i], dy = yj - py[i], dz = zj - pz[i];
+                double inv = nb_rsqrt(dx * dx + dy * dy + dz * dz + NB_SOFT * NB_SOFT);
+                double s = mj * inv * inv * inv;
+                ax[i] += s * dx;
+                ay[i] += s * dy;
+                az[i] += s * dz;
+            }
+        }
+    }
+}
+#else /* NB_BH */
+typedef struct {
+    double cx, cy, cz, half;  // cube center and half width
+    double m, mx, my, mz;     // total mass and center of mass
+    int child[8];             // child cells by octant, -1 if none
+    int body;                 // body of a leaf, -1 for other cells
+} Cell;
+
+static Cell cells[NB_MAXCELLS];
+static int num_cells;
+
+static int nb_new_cell(double cx, double cy, double cz, double half, int body) {
+    if (num_cells == NB_MAXCELLS) {
+        libmin_printf("ERROR: out of octree cells\n");
+        libmin_fail(1);
+    }
+    Cell *c = &cells[num_cells];
+    c->cx = cx; c->cy = cy; c->cz = cz; c->half = half;
+    for (int o = 0; o < 8; o++)
+        c->child[o] = -1;
+    c->body = body;
+    return num_cells++;
+}
+
+static int nb_octant(const Cell *c, int b) {
+    return (px[b] >= c->cx) | ((py[b] >= c->cy) << 1) | ((pz[b] >= c->cz) << 2);
+}
+
+// create the child cell of octant o of cell c, holding body b
+static int nb_new_child(int c, int o, int b) {
+    double h = 0.5 * cells[c].half;
+    return nb_new_cell(cells[c].cx + ((o & 1) ? h : -h),
+                       cells[c].cy + ((o & 2) ? h : -h),
+                       cells[c].cz + ((o & 4) ? h : -h), h, b);
+}
+
+static void nb_insert(int b) {
+    int c = 0;
+    for (int depth = 0; ; depth++) {
+        if (depth == NB_MAXDEPTH) {
+            libmin_printf("ERROR: octree too deep, coincident bodies?\n");
+            libmin_fail(1);
+        }
+        if (cells[c].body >= 0) {
+            // split the leaf, moving its body one level down
+            int old = cells[c].body;
+            int o = nb_octant(&cells[c], old);
+            cells[c].body = -1;
+            int child = nb_new_child(c, o, old);
+            cells[c].child[o] = child;
+        }
+        int o = nb_octant(&cells[c], b);
+        if (cells[c].child[o] < 0) {
+            int child = nb_new_child(c, o, b);
+            cells[c].child[o] = child;
+            return;
+        }
+        c = cells[c].child[o];
+    }
+}
+
+// compute the mass and center of mass of cell c and its subtree
+static void nb_summarize(int c) {
+    Cell *cell = &cells[c];
+    if (cell->body >= 0) {
+        int b = cell->body;
+        cell->m = mass[b];
+        cell->mx = px[b]; cell->my = py[b]; cell->mz = pz[b];
+        return;
+    }
+    double m = 0.0, mx = 0.0, my = 0.0, mz = 0.0;
+    for (int o = 0; o < 8; o++) {
+        int k = cell->child[o];
+        if (k < 0)
+            continue;
+        nb_summarize(k);
+        m += cells[k].m;
+        mx += cells[k].m * cells[k].mx;
+        my += cells[k].m * cells[k].my;
+        mz += cells[k].m * cells[k].mz;
+    }
+    cell->m = m;
+    cell->mx = mx / m; cell->my = my / m; cell->mz = mz / m;
+}
+
+static void nb_build_tree(void) {
+    double lo = px[0], hi = px[0];
+    for (int i = 0; i < NB_BODIES; i++) {
+        lo = MIN(lo, MIN(px[i], MIN(py[i], pz[i])));
+        hi = MAX(hi, MAX(px[i], MAX(py[i], pz[i])));
+    }
+    double half = 0.5 * (hi - lo) * 1.0001;
+    num_cells = 0;
+    int root = nb_new_cell(0.5 * (lo + hi), 0.5 * (lo + hi), 0.5 * (lo + hi), half, -1);
+
+    // the root starts as an empty internal cell
+    for (int i = 0; i < NB_BODIES; i++)
+        nb_insert(i);
+    nb_summarize(root);
+}
+
+// walk the tree for each body, a cell is used as a point mass at its center
+// of mass if its size is below THETA times the distance, and if it does not
+// hold the body itself
+static void nb_accel(void) {
+    nb_build_tree();
+
+    for (int i = 0; i < NB_BODIES; i++) {
+        int stack[8 * NB_MAXDEPTH], sp = 0;
+        double sx = 0.0, sy = 0.0, sz = 0.0;
+        stack[sp++] = 0;
+        while (sp > 0) {
+            const Cell *c = &cells[stack[--sp]];
+            if (c->body == i)
+                continue;
+            double dx = c->mx - px[i], dy = c->my - py[i], dz = c->mz - pz[i];
+            double d2 = dx * dx + dy * dy + dz * dz;
+            int inside = libmin_fabs(px[i] - c->cx) <= c->half
+                && libmin_fabs(py[i] - c->cy) <= c->half
+                && libmin_fabs(pz[i] - c->cz) <= c->half;
+            double size = 2.0 * c->half;
+            if (c->body < 0 && (inside || size * size >= THETA * THETA * d2)) {
+                for (int o = 0; o < 8; o++) {
+                    if (c->child[o] >= 0)
+                        stack[sp++] = c->child[o];
+                }
+                continue;
+            }
+            double inv = nb_rsqrt(d2 + NB_SOFT * NB_SOFT);
+            double s = c->m * inv * inv * inv;
+            sx += s * dx;
+            sy += s * dy;
+            sz += s * dz;
+        }
+        ax[i] = sx; ay[i] = sy; az[i] = sz;
+    }
+}
+#endif /* NB_SOA */
+
+int main(void) {
+    nb_init();
+    double e0 = nb_energy();
+    double p0[3], pscale = nb_momentum(p0);
+
+    libtarg_start_perf();
+    nb_accel();
+    for (int step = 0; step < NB_STEPS; step++) {
+        // kick-drift-kick leapfrog
+        for (int i = 0; i < NB_BODIES; i++) {
+            vx[i] += 0.5 * NB_DT * ax[i];
+            vy[i] += 0.5 * NB_DT * ay[i];
+            vz[i] += 0.5 * NB_DT * az[i];
+            px[i] += NB_DT * vx[i];
+            py[i] += NB_DT * vy[i];
+            pz[i] += NB_DT * vz[i];
+        }
+        nb_accel();
+        for (int i = 0; i < NB_BODIES; i++) {
+            vx[i] += 0.5 * NB_DT * ax[i];
+            vy[i] += 0.5 * NB_DT * ay[i];
+            vz[i] += 0.5 * NB_DT * az[i];
+        }
+    }
+    libtarg_stop_perf();
+
+    double e1 = nb_energy();
+    double err = libmin_fabs((e1 - e0) / e0);
+    double p1[3];
+    nb_momentum(p1);
+    double dpx = p1[0] - p0[0], dpy = p1[1] - p0[1], dpz = p1[2] - p0[2];
+    double perr = libmin_sqrt(dpx * dpx + dpy * dpy + dpz * dpz) / pscale;
+#ifdef NB_SOA
+    libmin_printf("Direct summation (SoA), %d bodies, %d steps\n", NB_BODIES, NB_STEPS);
+#else
+    libmin_printf("Barnes-Hut (theta = %.2f), %d bodies, %d steps\n", THETA, NB_BODIES, NB_STEPS);
+#endif
+#ifdef NB_VERBOSE
+    libmin_printf("Energy: initial %.9f, final %.9f, relative error %.12f\n", e0, e1, err);
+    libmin_printf("Momentum: relative change %.15f\n", perr);
+#endif
+    if (err > NB_ETOL) {
+        libmin_printf("ERROR: energy not conserved, relative error %.12f > %.9f\n", err, NB_ETOL);
+        libmin_fail(1);
+    }
+    if (perr > NB_PTOL) {
+        libmin_printf("ERROR: momentum not conserved, relative change %.15f > %.12f\n", perr, NB_PTOL);
+        libmin_fail(1);
+    }
+    libmin_printf("Energy conserved to within %.9f\n", NB_ETOL);
+    libmin_printf("Momentum conserved to within %.12f\n", NB_PTOL);
+
+    libmin_success();
+    return 0;
+}
+#else /* !NB_SOA && !NB_BH */
 typedef struct {
     double mass;
     double pos[3];
@@ -76,4 +418,4 @@ int main(void) {
     libmin_success();
     return 0;
 }
-
+#endif /* NB_SOA || NB_BH */
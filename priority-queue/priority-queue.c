@@ -5,6 +5,17 @@
 // using Linked List
 #include "libmin.h"
 
+#ifdef ALLOC_POOL
+// Queue nodes come from a contiguous object pool
+#define POOL_SIZE 256
+static libmin_pool_t node_pool;
+#define NODE_MALLOC(SZ)  libmin_pool_alloc(&node_pool)
+#define NODE_FREE(P)     libmin_pool_free(&node_pool, (P))
+#else /* !ALLOC_POOL */
+#define NODE_MALLOC(SZ)  libmin_malloc(SZ)
+#define NODE_FREE(P)     libmin_free(P)
+#endif /* ALLOC_POOL */
+
 // Node
 typedef struct node {
     int data;
@@ -19,7 +30,7 @@ typedef struct node {
 // Function to Create A New Node
 Node* newNode(int d, int p)
 {
-    Node* temp = (Node*)libmin_malloc(sizeof(Node));
+    Node* temp = (Node*)NODE_MALLOC(sizeof(Node));
     temp->data = d;
     temp->priority = p;
     temp->next = NULL;
@@ -45,7 +56,7 @@ void pop(Node** head)
 {
     Node* temp = *head;
     (*head) = (*head)->next;
-    libmin_free(temp);
+    NODE_FREE(temp);
 }
 
 // Function to push according to priority
@@ -101,6 +112,11 @@ printPQ(Node** pq)
 // Driver code
 int main()
 {
+#ifdef ALLOC_POOL
+    if (!libmin_pool_init(&node_pool, sizeof(Node), POOL_SIZE))
+        libmin_fail(1);
+#endif /* ALLOC_POOL */
+
     // Create a Priority Queue
     // 7->4->5->6
     Node* pq = newNode(4, 1);
@@ -110,6 +126,10 @@ int main()
     printPQ(&pq);
 
     libmin_srand(42);
+
+    // performance monitoring
+    libtarg_start_perf();
+
     pq = newNode(4, 1);
     for (int i=0; i < 250; i++)
     {
@@ -119,6 +139,12 @@ int main()
     }
     printPQ(&pq);
 
+    libtarg_stop_perf();
+
+#ifdef ALLOC_POOL
+    libmin_pool_destroy(&node_pool);
+#endif /* ALLOC_POOL */
+
     libmin_success();
     return 0;
 }
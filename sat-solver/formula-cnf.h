@@ -0,0 +1,2 @@
+#define __formula_sz 126
+const uint8_t __formula[126] = {0x63,0x20,0x74,0x68,0x65,0x20,0x62,0x75,0x69,0x6c,0x74,0x2d,0x69,0x6e,0x20,0x66,0x6f,0x72,0x6d,0x75,0x6c,0x61,0x20,0x6f,0x66,0x20,0x73,0x61,0x74,0x2d,0x73,0x6f,0x6c,0x76,0x65,0x72,0x2e,0x63,0xa,0x70,0x20,0x63,0x6e,0x66,0x20,0x38,0x20,0x31,0x30,0xa,0x31,0x20,0x32,0x20,0x33,0x20,0x30,0xa,0x2d,0x31,0x20,0x34,0x20,0x30,0xa,0x2d,0x32,0x20,0x34,0x20,0x30,0xa,0x2d,0x33,0x20,0x34,0x20,0x30,0xa,0x2d,0x34,0x20,0x35,0x20,0x36,0x20,0x30,0xa,0x2d,0x35,0x20,0x37,0x20,0x30,0xa,0x2d,0x36,0x20,0x37,0x20,0x30,0xa,0x2d,0x37,0x20,0x38,0x20,0x30,0xa,0x32,0x20,0x2d,0x36,0x20,0x38,0x20,0x30,0xa,0x2d,0x33,0x20,0x2d,0x38,0x20,0x30,0xa};
\ No newline at end of file
@@ -1,5 +1,629 @@
 #include "libmin.h"
 
+#ifdef CDCL
+// Conflict-driven clause-learning (CDCL) engine, in the style of MiniSat:
+// two-watched-literal unit propagation, first-UIP conflict analysis with
+// clause learning, VSIDS decisions with phase saving, Luby restarts, and
+// periodic deletion of inactive learnt clauses. The instance is read in
+// DIMACS CNF format from an in-memory file.
+
+#if defined(INSTANCE_formula)
+#include "formula-cnf.h"
+#define INSTANCE_NAME "formula"
+#define INSTANCE_SZ   __formula_sz
+#define INSTANCE_DATA __formula
+#elif defined(INSTANCE_uf100)
+#include "uf100-cnf.h"
+#define INSTANCE_NAME "uf100"
+#define INSTANCE_SZ   __uf100_sz
+#define INSTANCE_DATA __uf100
+#elif defined(INSTANCE_uuf100)
+#include "uuf100-cnf.h"
+#define INSTANCE_NAME "uuf100"
+#define INSTANCE_SZ   __uuf100_sz
+#define INSTANCE_DATA __uuf100
+#elif defined(INSTANCE_pigeon)
+#include "pigeon-cnf.h"
+#define INSTANCE_NAME "pigeon"
+#define INSTANCE_SZ   __pigeon_sz
+#define INSTANCE_DATA __pigeon
+#elif defined(INSTANCE_uf250)
+#include "uf250-cnf.h"
+#define INSTANCE_NAME "uf250"
+#define INSTANCE_SZ   __uf250_sz
+#define INSTANCE_DATA __uf250
+#elif defined(INSTANCE_uuf250)
+#include "uuf250-cnf.h"
+#define INSTANCE_NAME "uuf250"
+#define INSTANCE_SZ   __uuf250_sz
+#define INSTANCE_DATA __uuf250
+#elif defined(INSTANCE_uf20)
+#include "uf20-cnf.h"
+#define INSTANCE_NAME "uf20"
+#define INSTANCE_SZ   __uf20_sz
+#define INSTANCE_DATA __uf20
+#else
+#error No DIMACS instance selected, define INSTANCE_<name>.
+#endif
+
+MFILE __infile = {
+    INSTANCE_NAME ".cnf",
+    INSTANCE_SZ,
+    INSTANCE_DATA,
+    0
+};
+MFILE *infile = &__infile;
+
+#define MAX_VARS     1024      // Maximum number of variables
+#define MAX_CLS      32768     // Maximum number of original and learnt clauses
+#define MAX_ARENA    (1 << 18) // Maximum number of literals in all clauses
+#define RESTART_BASE 100       // Conflicts in one unit of the Luby sequence
+#define VAR_DECAY    0.95      // VSIDS activity decay
+#define CLA_DECAY    0.999     // Learnt clause activity decay
+
+// Literals are encoded as 2*var + sign, with sign 1 for a negated variable.
+#define LIT(v, neg)   (((v) << 1) | (neg))
+#define VAR(l)        ((l) >> 1)
+#define NEG(l)        ((l) ^ 1)
+#define L_UNDEF       -1
+
+// Clause database: the literals of each clause live in one arena, the first
+// two literals are watched, and each clause links into the watch lists of
+// those two literals through next[0] and next[1].
+static int arena[MAX_ARENA];
+static int arenaTop;
+static int clStart[MAX_CLS], clSize[MAX_CLS], clNext[MAX_CLS][2];
+static char clLearnt[MAX_CLS];
+static double clActivity[MAX_CLS];
+static int numCls, numOriginal, numLearnt;
+
+static int numVars;
+static int watches[2 * MAX_VARS];  // First clause watching each literal.
+static signed char assigns[MAX_VARS];  // Variable values, or L_UNDEF.
+static signed char savedPhase[MAX_VARS];
+static int level[MAX_VARS], reason[MAX_VARS];
+static char seen[MAX_VARS];
+static int trail[MAX_VARS], trailLim[MAX_VARS], trailSize, qhead, decisionLevel;
+
+// VSIDS: variable activities, and a binary max-heap of the decision candidates.
+static double activity[MAX_VARS], varInc = 1.0, claInc = 1.0;
+static int heap[MAX_VARS], heapPos[MAX_VARS], heapSize;
+
+static long decisions, conflicts, propagations, restarts, deleted;
+
+// Value of a literal: 1 true, 0 false, L_UNDEF unassigned.
+static inline int litValue(int lit) {
+    int val = assigns[VAR(lit)];
+    return val == L_UNDEF ? L_UNDEF : val ^ (lit & 1);
+}
+
+static void heapUp(int i) {
+    int v = heap[i];
+    while (i > 0 && activity[heap[(i - 1) / 2]] < activity[v]) {
+        heap[i] = heap[(i - 1) / 2];
+        heapPos[heap[i]] = i;
+        i = (i - 1) / 2;
+    }
+    heap[i] = v;
+    heapPos[v] = i;
+}
+
+static void heapDown(int i) {
+    int v = heap[i];
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= heapSize)
+            break;
+        if (child + 1 < heapSize && activity[heap[child + 1]] > activity[heap[child]])
+            child++;
+        if (activity[heap[child]] <= activity[v])
+            break;
+        heap[i] = heap[child];
+        heapPos[heap[i]] = i;
+        i = child;
+    }
+    heap[i] = v;
+    heapPos[v] = i;
+}
+
+static void heapInsert(int v) {
+    if (heapPos[v] >= 0)
+        return;
+    heap[heapSize] = v;
+    heapUp(heapSize++);
+}
+
+static int heapPop() {
+    int v = heap[0];
+    heapPos[v] = -1;
+    if (--heapSize > 0) {
+        heap[0] = heap[heapSize];
+        heapDown(0);
+    }
+    return v;
+}
+
+// Bump the activity of a variable, rescaling all activities on overflow.
+static void bumpVar(int v) {
+    activity[v] += varInc;
+    if (activity[v] > 1e100) {
+        for (int i = 0; i < numVars; i++)
+            activity[i] *= 1e-100;
+        varInc *= 1e-100;
+    }
+    if (heapPos[v] >= 0)
+        heapUp(heapPos[v]);
+}
+
+// Bump the activity of a learnt clause, rescaling on overflow.
+static void bumpClause(int c) {
+    clActivity[c] += claInc;
+    if (clActivity[c] > 1e20) {
+        for (int i = 0; i < numCls; i++)
+            clActivity[i] *= 1e-20;
+        claInc *= 1e-20;
+    }
+}
+
+// Assign a literal true, with the clause that implied it (or -1).
+static void enqueue(int lit, int from) {
+    int v = VAR(lit);
+    assigns[v] = !(lit & 1);
+    level[v] = decisionLevel;
+    reason[v] = from;
+    trail[trailSize++] = lit;
+}
+
+// Link clause c into the watch lists of its first two literals.
+static void watchClause(int c) {
+    for (int k = 0; k < 2; k++) {
+        int lit = arena[clStart[c] + k];
+        clNext[c][k] = watches[lit];
+        watches[lit] = c;
+    }
+}
+
+// Add a clause of size literals, returns its index.
+static int addClause(const int *lits, int size, int learnt) {
+    if (numCls >= MAX_CLS || arenaTop + size > MAX_ARENA) {
+        libmin_printf("ERROR: clause database is full\n");
+        libtarg_fail(1);
+    }
+    int c = numCls++;
+    clStart[c] = arenaTop;
+    clSize[c] = size;
+    clLearnt[c] = learnt;
+    clActivity[c] = 0.0;
+    for (int i = 0; i < size; i++)
+        arena[arenaTop++] = lits[i];
+    watchClause(c);
+    return c;
+}
+
+// Propagate all enqueued assignments, returns a conflicting clause or -1.
+static int propagate() {
+    while (qhead < trailSize) {
+        int falseLit = NEG(trail[qhead++]);
+        int *link = &watches[falseLit];
+        int c = *link;
+        propagations++;
+
+        while (c != -1) {
+            int *lits = &arena[clStart[c]];
+
+            // Make sure the false literal is the second watch.
+            if (lits[0] == falseLit) {
+                int t = lits[0]; lits[0] = lits[1]; lits[1] = t;
+                t = clNext[c][0]; clNext[c][0] = clNext[c][1]; clNext[c][1] = t;
+            }
+            int next = clNext[c][1];
+
+            // The clause is satisfied by the first watch.
+            if (litValue(lits[0]) == 1) {
+                link = &clNext[c][1];
+                c = next;
+                continue;
+            }
+
+            // Look for a new literal to watch.
+            int found = 0;
+            for (int k = 2; k < clSize[c]; k++) {
+                if (litValue(lits[k]) != 0) {
+                    lits[1] = lits[k];
+                    lits[k] = falseLit;
+                    *link = next;
+                    clNext[c][1] = watches[lits[1]];
+                    watches[lits[1]] = c;
+                    found = 1;
+                    break;
+                }
+            }
+            if (found) {
+                c = next;
+                continue;
+            }
+
+            // The clause is unit or conflicting.
+            if (litValue(lits[0]) == 0) {
+                qhead = trailSize;
+                return c;
+            }
+            enqueue(lits[0], c);
+            link = &clNext[c][1];
+            c = next;
+        }
+    }
+    return -1;
+}
+
+// Undo all assignments above the given decision level.
+static void backtrack(int toLevel) {
+    if (decisionLevel <= toLevel)
+        return;
+    for (int i = trailSize - 1; i >= trailLim[toLevel]; i--) {
+        int v = VAR(trail[i]);
+        savedPhase[v] = assigns[v];
+        assigns[v] = L_UNDEF;
+        heapInsert(v);
+    }
+    trailSize = qhead = trailLim[toLevel];
+    decisionLevel = toLevel;
+}
+
+// First-UIP conflict analysis: derive the learnt clause of a conflict into
+// learnt (asserting literal first), returns its size and the backjump level.
+static int analyze(int confl, int *learnt, int *btLevel) {
+    int pathCount = 0, lit = -1, index = trailSize - 1, size = 1;
+
+    do {
+        if (clLearnt[confl])
+            bumpClause(confl);
+        int *lits = &arena[clStart[confl]];
+        for (int j = (lit == -1) ? 0 : 1; j < clSize[confl]; j++) {
+            int q = lits[j], v = VAR(q);
+            if (!seen[v] && level[v] > 0) {
+                bumpVar(v);
+                seen[v] = 1;
+                if (level[v] >= decisionLevel)
+                    pathCount++;
+                else
+                    learnt[size++] = q;
+            }
+        }
+        // Select the next literal of the current level to expand.
+        while (!seen[VAR(trail[index--])])
+            ;
+        lit = trail[index + 1];
+        confl = reason[VAR(lit)];
+        seen[VAR(lit)] = 0;
+        pathCount--;
+    } while (pathCount > 0);
+    learnt[0] = NEG(lit);
+
+    // Minimize the clause: drop the literals implied by the others.
+    static int analyzed[MAX_VARS];
+    int kept = 1;
+    for (int i = 1; i < size; i++) {
+        int r = reason[VAR(learnt[i])], redundant = (r != -1);
+        analyzed[i] = learnt[i];
+        for (int k = 1; redundant && k < clSize[r]; k++) {
+            int u = VAR(arena[clStart[r] + k]);
+            redundant = seen[u] || level[u] == 0;
+        }
+        if (!redundant)
+            learnt[kept++] = learnt[i];
+    }
+    for (int i = 1; i < size; i++)
+        seen[VAR(analyzed[i])] = 0;
+    size = kept;
+
+    // Backjump to the highest level in the rest of the clause, and watch it.
+    *btLevel = 0;
+    for (int i = 1; i < size; i++) {
+        if (level[VAR(learnt[i])] > *btLevel) {
+            *btLevel = level[VAR(learnt[i])];
+            int t = learnt[1]; learnt[1] = learnt[i]; learnt[i] = t;
+        }
+    }
+    return size;
+}
+
+// Pick the unassigned variable with the highest activity, or -1.
+static int pickBranchVar() {
+    while (heapSize > 0) {
+        int v = heapPop();
+        if (assigns[v] == L_UNDEF)
+            return v;
+    }
+    return -1;
+}
+
+static int cmpActivity(const void *a, const void *b) {
+    double x = clActivity[*(const int *)a], y = clActivity[*(const int *)b];
+    return (x < y) ? -1 : (x > y) ? 1 : (*(const int *)a - *(const int *)b);
+}
+
+// Delete the less active half of the learnt clauses (keeping binary clauses
+// and the reasons of current assignments), then compact the clause database
+// and rebuild the watch lists, with the same literals watched.
+static void reduceDB() {
+    static int order[MAX_CLS], remap[MAX_CLS];
+    static char keep[MAX_CLS];
+    int count = 0;
+
+    for (int c = 0; c < numCls; c++) {
+        int v = VAR(arena[clStart[c]]);
+        int locked = assigns[v] != L_UNDEF && reason[v] == c;
+        keep[c] = 1;
+        if (clLearnt[c] && clSize[c] > 2 && !locked)
+            order[count++] = c;
+    }
+    libmin_qsort(order, count, sizeof(int), cmpActivity);
+    for (int i = 0; i < count / 2; i++)
+        keep[order[i]] = 0;
+
+    int top = 0, n = 0;
+    for (int c = 0; c < numCls; c++) {
+        if (!keep[c]) {
+            deleted++;
+            numLearnt--;
+            continue;
+        }
+        for (int i = 0; i < clSize[c]; i++)
+            arena[top + i] = arena[clStart[c] + i];
+        remap[c] = n;
+        clStart[n] = top;
+        clSize[n] = clSize[c];
+        clLearnt[n] = clLearnt[c];
+        clActivity[n] = clActivity[c];
+        top += clSize[c];
+        n++;
+    }
+    arenaTop = top;
+    numCls = n;
+
+    for (int i = 0; i < trailSize; i++) {
+        int v = VAR(trail[i]);
+        if (reason[v] >= 0)
+            reason[v] = remap[reason[v]];
+    }
+    for (int l = 0; l < 2 * numVars; l++)
+        watches[l] = -1;
+    for (int c = 0; c < numCls; c++)
+        watchClause(c);
+}
+
+// The Luby restart sequence: 1 1 2 1 1 2 4 1 1 2 1 1 2 4 8 ...
+static long luby(long i) {
+    long size = 1, seq = 0;
+    while (size < i + 1) {
+        seq++;
+        size = 2 * size + 1;
+    }
+    while (size - 1 != i) {
+        size = (size - 1) >> 1;
+        seq--;
+        i = i % size;
+    }
+    return 1L << seq;
+}
+
+// Search until a model or a refutation is found, returns 1 if satisfiable.
+static int solve() {
+    static int learnt[MAX_VARS];
+    long maxLearnts = numOriginal / 3 + 100;
+    long restartConflicts = RESTART_BASE * luby(0), conflictsHere = 0;
+
+    if (propagate() != -1)
+        return 0;
+
+    for (;;) {
+        int confl = propagate();
+        if (confl != -1) {
+            // Conflict: learn a clause and backjump.
+            conflicts++;
+            conflictsHere++;
+            if (decisionLevel == 0)
+                return 0;
+            int btLevel, size = analyze(confl, learnt, &btLevel);
+            backtrack(btLevel);
+            if (size == 1)
+                enqueue(learnt[0], -1);
+            else {
+                int c = addClause(learnt, size, 1);
+                numLearnt++;
+                bumpClause(c);
+                enqueue(learnt[0], c);
+            }
+            varInc *= 1 / VAR_DECAY;
+            claInc *= 1 / CLA_DECAY;
+
+            // Clean up the learnt clauses if there are too many, or if the
+            // clause database could not take another one.
+            if (numLearnt - trailSize >= maxLearnts) {
+                reduceDB();
+                maxLearnts += maxLearnts / 10;
+            }
+            else if (numCls + 1 >= MAX_CLS || arenaTop + numVars >= MAX_ARENA)
+                reduceDB();
+            continue;
+        }
+
+        if (conflictsHere >= restartConflicts) {
+            // Restart from decision level 0.
+            restarts++;
+            conflictsHere = 0;
+            restartConflicts = RESTART_BASE * luby(restarts);
+            backtrack(0);
+            continue;
+        }
+
+        // Decide: the most active variable, with its saved phase.
+        int v = pickBranchVar();
+        if (v < 0)
+            return 1;  // All variables are assigned, a model is found.
+        decisions++;
+        trailLim[decisionLevel++] = trailSize;
+        enqueue(LIT(v, !savedPhase[v]), -1);
+    }
+}
+
+// Read a (possibly negative) integer from the DIMACS input, skipping white
+// space and comment lines, returns 0 at the end of the input. SATLIB
+// instances end with a "%" line followed by a stray "0", so "%" also ends
+// the input.
+static int readInt(int *value) {
+    int ch = libmin_mgetc(infile);
+    for (;;) {
+        while (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r')
+            ch = libmin_mgetc(infile);
+        if (ch == '%')
+            return 0;
+        if (ch != 'c' && ch != 'p')
+            break;
+        if (ch == 'p') {
+            // Skip the "p cnf" keywords, the counts follow.
+            while (ch != EOF && !isdigit(ch))
+                ch = libmin_mgetc(infile);
+            break;
+        }
+        while (ch != EOF && ch != '\n')
+            ch = libmin_mgetc(infile);
+    }
+    if (ch == EOF)
+        return 0;
+
+    int neg = 0, n = 0;
+    if (ch == '-') {
+        neg = 1;
+        ch = libmin_mgetc(infile);
+    }
+    if (ch == EOF || !isdigit(ch)) {
+        libmin_printf("ERROR: unexpected character '%c' in DIMACS input\n", ch);
+        libtarg_fail(1);
+    }
+    while (ch != EOF && isdigit(ch)) {
+        n = n * 10 + (ch - '0');
+        ch = libmin_mgetc(infile);
+    }
+    *value = neg ? -n : n;
+    return 1;
+}
+
+// Read the DIMACS instance, returns 0 if it contains an empty clause or
+// conflicting unit clauses.
+static int readDimacs(int *numClauses) {
+    static int lits[MAX_VARS];
+    int consistent = 1, size = 0, value;
+
+    libmin_mopen(infile, "r");
+    if (!readInt(&numVars) || !readInt(numClauses) || numVars > MAX_VARS) {
+        libmin_printf("ERROR: bad DIMACS header\n");
+        libtarg_fail(1);
+    }
+    for (int v = 0; v < numVars; v++) {
+        assigns[v] = L_UNDEF;
+        savedPhase[v] = 0;
+        reason[v] = -1;
+        heapPos[v] = -1;
+        heapInsert(v);
+    }
+    for (int l = 0; l < 2 * numVars; l++)
+        watches[l] = -1;
+
+    int tautology = 0;
+    while (readInt(&value)) {
+        if (value != 0) {
+            if (libmin_abs(value) > numVars) {
+                libmin_printf("ERROR: variable %d is out of range\n", value);
+                libtarg_fail(1);
+            }
+            // Drop duplicate literals, and clauses with complementary literals.
+            int lit = LIT(libmin_abs(value) - 1, value < 0), dup = 0;
+            for (int i = 0; i < size; i++) {
+                dup |= (lits[i] == lit);
+                tautology |= (lits[i] == NEG(lit));
+            }
+            if (!dup)
+                lits[size++] = lit;
+            continue;
+        }
+
+        // End of clause.
+        if (tautology)
+            ;
+        else if (size == 0)
+            consistent = 0;
+        else if (size == 1) {
+            if (litValue(lits[0]) == 0)
+                consistent = 0;
+            else if (litValue(lits[0]) == L_UNDEF)
+                enqueue(lits[0], -1);
+        }
+        else if (size > 1)
+            addClause(lits, size, 0);
+        size = tautology = 0;
+    }
+    libmin_mclose(infile);
+    numOriginal = numCls;
+    return consistent;
+}
+
+int main() {
+    static int model[MAX_VARS];
+    int numClauses;
+
+    int consistent = readDimacs(&numClauses);
+    libmin_printf("c instance %s: %d variables, %d clauses\n",
+        INSTANCE_NAME, numVars, numClauses);
+
+    libtarg_start_perf();
+    int sat = consistent && solve();
+    libtarg_stop_perf();
+
+    if (sat) {
+        libmin_printf("s SATISFIABLE\n");
+        for (int v = 0; v < numVars; v++)
+            model[v] = assigns[v];
+        for (int v = 0; v < numVars; v++) {
+            libmin_printf("%s%s%d", (v % 10 == 0) ? "v " : " ",
+                model[v] ? "" : "-", v + 1);
+            if (v % 10 == 9)
+                libmin_printf("\n");
+        }
+        libmin_printf("%s0\n", (numVars % 10 == 0) ? "v " : " ");
+
+        // Check the model against the original clauses, as read.
+        int unsat = 0, value, satisfied = 0;
+        libmin_mopen(infile, "r");
+        readInt(&value);
+        readInt(&value);
+        while (readInt(&value)) {
+            if (value != 0)
+                satisfied |= (model[libmin_abs(value) - 1] == (value > 0));
+            else {
+                unsat += !satisfied;
+                satisfied = 0;
+            }
+        }
+        libmin_mclose(infile);
+        if (unsat) {
+            libmin_printf("c ERROR: %d clauses are not satisfied\n", unsat);
+            libtarg_fail(1);
+        }
+        libmin_printf("c model satisfies all clauses\n");
+    }
+    else
+        libmin_printf("s UNSATISFIABLE\n");
+
+    libmin_printf("c %ld decisions, %ld conflicts, %ld propagations, %ld restarts\n",
+        decisions, conflicts, propagations, restarts);
+    libmin_printf("c %d learnt clauses kept, %ld deleted\n", numLearnt, deleted);
+
+    libmin_success();
+    return 0;
+}
+#else /* !CDCL */
 #define NUM_VARS     8      // Number of variables: x1, x2, ..., x8
 #define NUM_CLAUSES  10     // Total number of clauses in the CNF formula
 #define MAX_LITERALS 4      // Maximum literals per clause (including terminating 0)
@@ -105,11 +729,12 @@ int main() {
     if (solveSAT(1)) {
         libmin_printf("SAT solution found:\n");
         printAssignment();
-        libtarg_success();
+        libmin_success();
     } else {
         libmin_printf("No SAT solution exists.\n");
         libtarg_fail(1);
     }
     return 0;
 }
+#endif /* CDCL */
 
@@ -0,0 +1,2 @@
+#define __uuf100_sz 5370
+const uint8_t __uuf100[5370] = {0x63,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x20,0x33,0x2d,0x53,0x41,0x54,0x2c,0x20,0x31,0x30,0x30,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x2c,0x20,0x34,0x33,0x30,0x20,0x63,0x6c,0x61,0x75,0x73,0x65,0x73,0x2c,0x20,0x73,0x65,0x65,0x64,0x20,0x31,0xa,0x63,0x20,0x75,0x6e,0x73,0x61,0x74,0x69,0x73,0x66,0x69,0x61,0x62,0x6c,0x65,0xa,0x70,0x20,0x63,0x6e,0x66,0x20,0x31,0x30,0x30,0x20,0x34,0x33,0x30,0xa,0x31,0x38,0x20,0x37,0x33,0x20,0x2d,0x39,0x38,0x20,0x30,0xa,0x2d,0x36,0x31,0x20,0x38,0x34,0x20,0x34,0x39,0x20,0x30,0xa,0x2d,0x35,0x30,0x20,0x35,0x36,0x20,0x37,0x38,0x20,0x30,0xa,0x2d,0x39,0x33,0x20,0x2d,0x33,0x30,0x20,0x37,0x36,0x20,0x30,0xa,0x34,0x20,0x2d,0x38,0x34,0x20,0x2d,0x37,0x30,0x20,0x30,0xa,0x2d,0x35,0x35,0x20,0x2d,0x39,0x33,0x20,0x2d,0x34,0x20,0x30,0xa,0x37,0x31,0x20,0x33,0x30,0x20,0x34,0x35,0x20,0x30,0xa,0x2d,0x33,0x38,0x20,0x2d,0x33,0x20,0x2d,0x35,0x34,0x20,0x30,0xa,0x2d,0x32,0x34,0x20,0x38,0x31,0x20,0x39,0x33,0x20,0x30,0xa,0x2d,0x39,0x33,0x20,0x39,0x32,0x20,0x2d,0x36,0x35,0x20,0x30,0xa,0x38,0x36,0x20,0x2d,0x32,0x35,0x20,0x33,0x39,0x20,0x30,0xa,0x2d,0x36,0x35,0x20,0x35,0x31,0x20,0x2d,0x37,0x36,0x20,0x30,0xa,0x35,0x32,0x20,0x2d,0x35,0x34,0x20,0x2d,0x38,0x36,0x20,0x30,0xa,0x38,0x37,0x20,0x2d,0x39,0x35,0x20,0x34,0x38,0x20,0x30,0xa,0x32,0x31,0x20,0x2d,0x36,0x37,0x20,0x35,0x31,0x20,0x30,0xa,0x2d,0x34,0x30,0x20,0x39,0x31,0x20,0x37,0x39,0x20,0x30,0xa,0x2d,0x36,0x35,0x20,0x2d,0x33,0x30,0x20,0x2d,0x32,0x20,0x30,0xa,0x33,0x30,0x20,0x2d,0x35,0x32,0x20,0x36,0x36,0x20,0x30,0xa,0x2d,0x33,0x35,0x20,0x2d,0x38,0x35,0x20,0x37,0x31,0x20,0x30,0xa,0x2d,0x39,0x35,0x20,0x2d,0x36,0x36,0x20,0x31,0x37,0x20,0x30,0xa,0x2d,0x38,0x20,0x36,0x32,0x20,0x2d,0x34,0x37,0x20,0x30,0xa,0x36,0x33,0x20,0x2d,0x34,0x36,0x20,0x2d,0x35,0x34,0x20,0x30,0xa,0x2d,0x37,0x39,0x20,0x2d,0x34,0x33,0x20,0x2d,0x35,0x39,0x20,0x30,0xa,0x2d,0x37,0x31,0x20,0x2d,0x37,0x35,0x20,0x2d,0x32,0x34,0x20,0x30,0xa,0x33,0x33,0x20,0x2d,0x35,0x20,0x38,0x37,0x20,0x30,0xa,0x39,0x37,0x20,0x2d,0x33,0x36,0x20,0x33,0x32,0x20,0x30,0xa,0x33,0x38,0x20,0x2d,0x39,0x20,0x32,0x32,0x20,0x30,0xa,0x33,0x35,0x20,0x2d,0x38,0x33,0x20,0x39,0x32,0x20,0x30,0xa,0x31,0x35,0x20,0x34,0x20,0x34,0x30,0x20,0x30,0xa,0x2d,0x31,0x34,0x20,0x33,0x33,0x20,0x2d,0x39,0x34,0x20,0x30,0xa,0x33,0x20,0x2d,0x32,0x39,0x20,0x35,0x31,0x20,0x30,0xa,0x39,0x31,0x20,0x2d,0x36,0x35,0x20,0x2d,0x38,0x37,0x20,0x30,0xa,0x38,0x31,0x20,0x2d,0x38,0x39,0x20,0x36,0x37,0x20,0x30,0xa,0x2d,0x38,0x37,0x20,0x37,0x34,0x20,0x2d,0x34,0x32,0x20,0x30,0xa,0x31,0x37,0x20,0x2d,0x32,0x38,0x20,0x37,0x20,0x30,0xa,0x33,0x39,0x20,0x39,0x36,0x20,0x32,0x31,0x20,0x30,0xa,0x2d,0x35,0x20,0x2d,0x37,0x36,0x20,0x32,0x38,0x20,0x30,0xa,0x2d,0x31,0x30,0x30,0x20,0x39,0x31,0x20,0x38,0x30,0x20,0x30,0xa,0x2d,0x32,0x37,0x20,0x2d,0x37,0x34,0x20,0x38,0x37,0x20,0x30,0xa,0x2d,0x38,0x36,0x20,0x35,0x30,0x20,0x2d,0x33,0x38,0x20,0x30,0xa,0x35,0x32,0x20,0x2d,0x33,0x37,0x20,0x2d,0x33,0x20,0x30,0xa,0x37,0x33,0x20,0x31,0x38,0x20,0x34,0x34,0x20,0x30,0xa,0x2d,0x34,0x39,0x20,0x2d,0x37,0x31,0x20,0x2d,0x34,0x35,0x20,0x30,0xa,0x39,0x39,0x20,0x36,0x39,0x20,0x33,0x31,0x20,0x30,0xa,0x32,0x32,0x20,0x36,0x39,0x20,0x2d,0x32,0x38,0x20,0x30,0xa,0x33,0x33,0x20,0x34,0x38,0x20,0x2d,0x34,0x34,0x20,0x30,0xa,0x2d,0x37,0x38,0x20,0x31,0x30,0x30,0x20,0x2d,0x39,0x32,0x20,0x30,0xa,0x31,0x34,0x20,0x34,0x32,0x20,0x2d,0x36,0x20,0x30,0xa,0x31,0x39,0x20,0x2d,0x31,0x37,0x20,0x2d,0x34,0x34,0x20,0x30,0xa,0x31,0x30,0x20,0x37,0x34,0x20,0x37,0x31,0x20,0x30,0xa,0x2d,0x33,0x38,0x20,0x37,0x33,0x20,0x36,0x39,0x20,0x30,0xa,0x2d,0x36,0x20,0x33,0x38,0x20,0x32,0x20,0x30,0xa,0x2d,0x36,0x20,0x2d,0x32,0x35,0x20,0x33,0x31,0x20,0x30,0xa,0x35,0x38,0x20,0x2d,0x32,0x32,0x20,0x38,0x38,0x20,0x30,0xa,0x2d,0x34,0x39,0x20,0x2d,0x37,0x30,0x20,0x33,0x38,0x20,0x30,0xa,0x32,0x37,0x20,0x38,0x34,0x20,0x2d,0x34,0x31,0x20,0x30,0xa,0x33,0x38,0x20,0x39,0x33,0x20,0x37,0x37,0x20,0x30,0xa,0x2d,0x39,0x20,0x34,0x31,0x20,0x37,0x37,0x20,0x30,0xa,0x2d,0x38,0x30,0x20,0x31,0x30,0x30,0x20,0x37,0x30,0x20,0x30,0xa,0x32,0x34,0x20,0x37,0x30,0x20,0x32,0x37,0x20,0x30,0xa,0x33,0x36,0x20,0x2d,0x31,0x32,0x20,0x2d,0x39,0x37,0x20,0x30,0xa,0x33,0x30,0x20,0x35,0x30,0x20,0x2d,0x34,0x30,0x20,0x30,0xa,0x37,0x35,0x20,0x2d,0x33,0x39,0x20,0x2d,0x33,0x32,0x20,0x30,0xa,0x37,0x37,0x20,0x2d,0x31,0x32,0x20,0x33,0x32,0x20,0x30,0xa,0x2d,0x33,0x35,0x20,0x37,0x31,0x20,0x31,0x30,0x20,0x30,0xa,0x39,0x37,0x20,0x2d,0x34,0x36,0x20,0x36,0x34,0x20,0x30,0xa,0x2d,0x31,0x30,0x30,0x20,0x2d,0x34,0x32,0x20,0x31,0x30,0x20,0x30,0xa,0x32,0x30,0x20,0x2d,0x31,0x39,0x20,0x2d,0x34,0x31,0x20,0x30,0xa,0x2d,0x37,0x38,0x20,0x33,0x38,0x20,0x2d,0x31,0x37,0x20,0x30,0xa,0x2d,0x35,0x20,0x2d,0x31,0x30,0x30,0x20,0x2d,0x34,0x31,0x20,0x30,0xa,0x37,0x31,0x20,0x39,0x36,0x20,0x2d,0x38,0x39,0x20,0x30,0xa,0x37,0x20,0x2d,0x39,0x32,0x20,0x2d,0x38,0x36,0x20,0x30,0xa,0x35,0x38,0x20,0x35,0x36,0x20,0x2d,0x37,0x31,0x20,0x30,0xa,0x32,0x20,0x35,0x31,0x20,0x2d,0x34,0x34,0x20,0x30,0xa,0x35,0x34,0x20,0x37,0x34,0x20,0x33,0x20,0x30,0xa,0x2d,0x31,0x37,0x20,0x31,0x38,0x20,0x2d,0x33,0x34,0x20,0x30,0xa,0x32,0x33,0x20,0x37,0x39,0x20,0x2d,0x31,0x32,0x20,0x30,0xa,0x2d,0x36,0x35,0x20,0x2d,0x38,0x34,0x20,0x35,0x37,0x20,0x30,0xa,0x34,0x31,0x20,0x36,0x34,0x20,0x38,0x38,0x20,0x30,0xa,0x2d,0x37,0x32,0x20,0x37,0x39,0x20,0x2d,0x39,0x34,0x20,0x30,0xa,0x2d,0x37,0x20,0x2d,0x31,0x30,0x20,0x39,0x38,0x20,0x30,0xa,0x39,0x39,0x20,0x32,0x37,0x20,0x2d,0x34,0x30,0x20,0x30,0xa,0x32,0x32,0x20,0x39,0x30,0x20,0x39,0x35,0x20,0x30,0xa,0x37,0x38,0x20,0x36,0x36,0x20,0x37,0x34,0x20,0x30,0xa,0x2d,0x37,0x33,0x20,0x39,0x33,0x20,0x39,0x37,0x20,0x30,0xa,0x2d,0x38,0x32,0x20,0x34,0x35,0x20,0x2d,0x35,0x30,0x20,0x30,0xa,0x2d,0x36,0x20,0x2d,0x36,0x38,0x20,0x31,0x32,0x20,0x30,0xa,0x2d,0x31,0x31,0x20,0x2d,0x31,0x38,0x20,0x2d,0x31,0x30,0x30,0x20,0x30,0xa,0x2d,0x31,0x31,0x20,0x35,0x37,0x20,0x2d,0x33,0x31,0x20,0x30,0xa,0x2d,0x35,0x36,0x20,0x35,0x31,0x20,0x2d,0x32,0x32,0x20,0x30,0xa,0x36,0x33,0x20,0x2d,0x32,0x38,0x20,0x2d,0x31,0x36,0x20,0x30,0xa,0x38,0x35,0x20,0x2d,0x33,0x38,0x20,0x33,0x36,0x20,0x30,0xa,0x2d,0x32,0x35,0x20,0x36,0x38,0x20,0x2d,0x35,0x37,0x20,0x30,0xa,0x33,0x32,0x20,0x33,0x34,0x20,0x32,0x37,0x20,0x30,0xa,0x34,0x30,0x20,0x2d,0x37,0x35,0x20,0x2d,0x39,0x37,0x20,0x30,0xa,0x32,0x32,0x20,0x2d,0x37,0x30,0x20,0x2d,0x34,0x36,0x20,0x30,0xa,0x37,0x34,0x20,0x35,0x30,0x20,0x2d,0x32,0x37,0x20,0x30,0xa,0x31,0x36,0x20,0x37,0x33,0x20,0x2d,0x39,0x36,0x20,0x30,0xa,0x39,0x33,0x20,0x38,0x34,0x20,0x2d,0x31,0x38,0x20,0x30,0xa,0x35,0x36,0x20,0x2d,0x36,0x35,0x20,0x38,0x37,0x20,0x30,0xa,0x35,0x37,0x20,0x2d,0x39,0x32,0x20,0x35,0x38,0x20,0x30,0xa,0x39,0x34,0x20,0x2d,0x38,0x38,0x20,0x37,0x34,0x20,0x30,0xa,0x2d,0x32,0x37,0x20,0x2d,0x37,0x32,0x20,0x2d,0x31,0x20,0x30,0xa,0x39,0x35,0x20,0x2d,0x39,0x34,0x20,0x2d,0x36,0x36,0x20,0x30,0xa,0x2d,0x36,0x37,0x20,0x2d,0x35,0x33,0x20,0x2d,0x39,0x36,0x20,0x30,0xa,0x2d,0x35,0x38,0x20,0x38,0x30,0x20,0x38,0x36,0x20,0x30,0xa,0x2d,0x35,0x30,0x20,0x37,0x35,0x20,0x2d,0x35,0x35,0x20,0x30,0xa,0x39,0x34,0x20,0x2d,0x39,0x30,0x20,0x39,0x36,0x20,0x30,0xa,0x38,0x34,0x20,0x2d,0x33,0x38,0x20,0x38,0x31,0x20,0x30,0xa,0x2d,0x31,0x30,0x30,0x20,0x2d,0x35,0x31,0x20,0x2d,0x33,0x35,0x20,0x30,0xa,0x2d,0x37,0x38,0x20,0x2d,0x32,0x20,0x34,0x35,0x20,0x30,0xa,0x38,0x38,0x20,0x2d,0x37,0x30,0x20,0x33,0x39,0x20,0x30,0xa,0x36,0x30,0x20,0x36,0x36,0x20,0x2d,0x36,0x20,0x30,0xa,0x39,0x20,0x34,0x36,0x20,0x2d,0x38,0x35,0x20,0x30,0xa,0x32,0x31,0x20,0x2d,0x38,0x39,0x20,0x2d,0x31,0x32,0x20,0x30,0xa,0x2d,0x32,0x37,0x20,0x36,0x38,0x20,0x33,0x31,0x20,0x30,0xa,0x36,0x37,0x20,0x2d,0x38,0x35,0x20,0x34,0x38,0x20,0x30,0xa,0x2d,0x33,0x39,0x20,0x2d,0x38,0x34,0x20,0x39,0x35,0x20,0x30,0xa,0x37,0x39,0x20,0x39,0x35,0x20,0x33,0x30,0x20,0x30,0xa,0x2d,0x33,0x34,0x20,0x37,0x39,0x20,0x2d,0x34,0x33,0x20,0x30,0xa,0x2d,0x33,0x32,0x20,0x2d,0x38,0x35,0x20,0x34,0x20,0x30,0xa,0x2d,0x35,0x36,0x20,0x39,0x38,0x20,0x2d,0x33,0x32,0x20,0x30,0xa,0x2d,0x32,0x32,0x20,0x2d,0x37,0x35,0x20,0x35,0x37,0x20,0x30,0xa,0x33,0x34,0x20,0x2d,0x35,0x39,0x20,0x2d,0x36,0x38,0x20,0x30,0xa,0x2d,0x35,0x37,0x20,0x34,0x37,0x20,0x2d,0x34,0x30,0x20,0x30,0xa,0x39,0x32,0x20,0x38,0x38,0x20,0x34,0x30,0x20,0x30,0xa,0x31,0x33,0x20,0x2d,0x32,0x34,0x20,0x2d,0x36,0x20,0x30,0xa,0x32,0x38,0x20,0x2d,0x38,0x38,0x20,0x2d,0x35,0x20,0x30,0xa,0x2d,0x37,0x39,0x20,0x35,0x37,0x20,0x2d,0x34,0x34,0x20,0x30,0xa,0x32,0x33,0x20,0x31,0x33,0x20,0x32,0x39,0x20,0x30,0xa,0x2d,0x32,0x32,0x20,0x33,0x30,0x20,0x2d,0x33,0x31,0x20,0x30,0xa,0x32,0x38,0x20,0x35,0x38,0x20,0x39,0x32,0x20,0x30,0xa,0x32,0x38,0x20,0x31,0x31,0x20,0x36,0x20,0x30,0xa,0x2d,0x35,0x30,0x20,0x37,0x35,0x20,0x2d,0x33,0x37,0x20,0x30,0xa,0x2d,0x39,0x38,0x20,0x38,0x33,0x20,0x32,0x30,0x20,0x30,0xa,0x2d,0x38,0x36,0x20,0x37,0x30,0x20,0x38,0x20,0x30,0xa,0x38,0x34,0x20,0x33,0x39,0x20,0x2d,0x32,0x20,0x30,0xa,0x36,0x20,0x33,0x36,0x20,0x31,0x30,0x30,0x20,0x30,0xa,0x38,0x32,0x20,0x2d,0x31,0x37,0x20,0x39,0x36,0x20,0x30,0xa,0x2d,0x35,0x38,0x20,0x2d,0x35,0x30,0x20,0x2d,0x34,0x33,0x20,0x30,0xa,0x2d,0x33,0x32,0x20,0x2d,0x38,0x20,0x37,0x36,0x20,0x30,0xa,0x2d,0x37,0x38,0x20,0x2d,0x39,0x30,0x20,0x2d,0x37,0x32,0x20,0x30,0xa,0x37,0x31,0x20,0x2d,0x35,0x33,0x20,0x36,0x39,0x20,0x30,0xa,0x38,0x35,0x20,0x2d,0x39,0x20,0x2d,0x39,0x32,0x20,0x30,0xa,0x2d,0x31,0x30,0x20,0x33,0x33,0x20,0x2d,0x32,0x33,0x20,0x30,0xa,0x2d,0x35,0x35,0x20,0x2d,0x36,0x20,0x2d,0x37,0x20,0x30,0xa,0x2d,0x36,0x35,0x20,0x34,0x38,0x20,0x2d,0x31,0x33,0x20,0x30,0xa,0x2d,0x35,0x37,0x20,0x2d,0x38,0x36,0x20,0x2d,0x31,0x37,0x20,0x30,0xa,0x2d,0x35,0x38,0x20,0x34,0x20,0x2d,0x39,0x35,0x20,0x30,0xa,0x2d,0x31,0x31,0x20,0x33,0x39,0x20,0x35,0x20,0x30,0xa,0x2d,0x39,0x35,0x20,0x2d,0x31,0x37,0x20,0x2d,0x33,0x34,0x20,0x30,0xa,0x2d,0x33,0x39,0x20,0x2d,0x31,0x33,0x20,0x35,0x35,0x20,0x30,0xa,0x2d,0x34,0x34,0x20,0x2d,0x36,0x36,0x20,0x35,0x31,0x20,0x30,0xa,0x2d,0x38,0x34,0x20,0x2d,0x35,0x38,0x20,0x2d,0x36,0x38,0x20,0x30,0xa,0x39,0x30,0x20,0x2d,0x36,0x37,0x20,0x2d,0x36,0x39,0x20,0x30,0xa,0x39,0x36,0x20,0x2d,0x32,0x31,0x20,0x32,0x36,0x20,0x30,0xa,0x34,0x35,0x20,0x31,0x37,0x20,0x2d,0x37,0x34,0x20,0x30,0xa,0x36,0x39,0x20,0x34,0x31,0x20,0x35,0x34,0x20,0x30,0xa,0x39,0x36,0x20,0x36,0x37,0x20,0x36,0x35,0x20,0x30,0xa,0x39,0x34,0x20,0x2d,0x34,0x32,0x20,0x37,0x34,0x20,0x30,0xa,0x2d,0x34,0x37,0x20,0x2d,0x39,0x35,0x20,0x2d,0x34,0x39,0x20,0x30,0xa,0x2d,0x38,0x20,0x2d,0x31,0x38,0x20,0x2d,0x37,0x20,0x30,0xa,0x2d,0x33,0x32,0x20,0x39,0x30,0x20,0x2d,0x37,0x34,0x20,0x30,0xa,0x38,0x33,0x20,0x2d,0x34,0x38,0x20,0x35,0x32,0x20,0x30,0xa,0x36,0x35,0x20,0x2d,0x32,0x32,0x20,0x2d,0x34,0x20,0x30,0xa,0x31,0x35,0x20,0x2d,0x32,0x34,0x20,0x39,0x39,0x20,0x30,0xa,0x31,0x33,0x20,0x37,0x30,0x20,0x38,0x38,0x20,0x30,0xa,0x2d,0x38,0x31,0x20,0x2d,0x37,0x34,0x20,0x2d,0x36,0x38,0x20,0x30,0xa,0x2d,0x32,0x38,0x20,0x38,0x33,0x20,0x2d,0x32,0x33,0x20,0x30,0xa,0x36,0x33,0x20,0x39,0x31,0x20,0x33,0x37,0x20,0x30,0xa,0x2d,0x33,0x31,0x20,0x2d,0x35,0x35,0x20,0x2d,0x35,0x38,0x20,0x30,0xa,0x2d,0x36,0x32,0x20,0x2d,0x39,0x33,0x20,0x31,0x30,0x20,0x30,0xa,0x2d,0x32,0x36,0x20,0x32,0x20,0x2d,0x39,0x36,0x20,0x30,0xa,0x2d,0x31,0x30,0x20,0x2d,0x35,0x32,0x20,0x2d,0x37,0x39,0x20,0x30,0xa,0x36,0x20,0x2d,0x34,0x36,0x20,0x2d,0x35,0x39,0x20,0x30,0xa,0x38,0x33,0x20,0x31,0x20,0x2d,0x37,0x30,0x20,0x30,0xa,0x2d,0x39,0x36,0x20,0x2d,0x34,0x31,0x20,0x2d,0x31,0x30,0x30,0x20,0x30,0xa,0x2d,0x36,0x38,0x20,0x2d,0x35,0x33,0x20,0x2d,0x37,0x30,0x20,0x30,0xa,0x37,0x38,0x20,0x38,0x31,0x20,0x2d,0x37,0x35,0x20,0x30,0xa,0x2d,0x37,0x36,0x20,0x2d,0x31,0x38,0x20,0x37,0x31,0x20,0x30,0xa,0x2d,0x32,0x20,0x35,0x35,0x20,0x39,0x35,0x20,0x30,0xa,0x2d,0x33,0x37,0x20,0x2d,0x38,0x35,0x20,0x2d,0x39,0x37,0x20,0x30,0xa,0x31,0x20,0x2d,0x35,0x30,0x20,0x33,0x35,0x20,0x30,0xa,0x39,0x36,0x20,0x36,0x32,0x20,0x39,0x39,0x20,0x30,0xa,0x34,0x36,0x20,0x2d,0x31,0x39,0x20,0x2d,0x35,0x34,0x20,0x30,0xa,0x2d,0x34,0x38,0x20,0x2d,0x31,0x37,0x20,0x37,0x36,0x20,0x30,0xa,0x36,0x36,0x20,0x33,0x37,0x20,0x39,0x35,0x20,0x30,0xa,0x2d,0x36,0x33,0x20,0x2d,0x32,0x38,0x20,0x39,0x32,0x20,0x30,0xa,0x35,0x35,0x20,0x2d,0x31,0x32,0x20,0x39,0x20,0x30,0xa,0x34,0x20,0x2d,0x31,0x34,0x20,0x33,0x33,0x20,0x30,0xa,0x2d,0x38,0x34,0x20,0x39,0x33,0x20,0x2d,0x32,0x34,0x20,0x30,0xa,0x2d,0x37,0x20,0x37,0x31,0x20,0x2d,0x32,0x38,0x20,0x30,0xa,0x2d,0x31,0x34,0x20,0x2d,0x39,0x35,0x20,0x2d,0x37,0x31,0x20,0x30,0xa,0x33,0x34,0x20,0x2d,0x38,0x38,0x20,0x2d,0x33,0x36,0x20,0x30,0xa,0x2d,0x37,0x20,0x2d,0x32,0x38,0x20,0x38,0x37,0x20,0x30,0xa,0x2d,0x35,0x38,0x20,0x2d,0x33,0x38,0x20,0x38,0x38,0x20,0x30,0xa,0x36,0x32,0x20,0x2d,0x31,0x34,0x20,0x32,0x30,0x20,0x30,0xa,0x2d,0x36,0x37,0x20,0x2d,0x33,0x33,0x20,0x2d,0x35,0x34,0x20,0x30,0xa,0x2d,0x36,0x34,0x20,0x2d,0x38,0x32,0x20,0x2d,0x37,0x30,0x20,0x30,0xa,0x2d,0x36,0x33,0x20,0x2d,0x31,0x34,0x20,0x32,0x20,0x30,0xa,0x2d,0x39,0x31,0x20,0x33,0x35,0x20,0x2d,0x38,0x20,0x30,0xa,0x31,0x33,0x20,0x2d,0x33,0x30,0x20,0x36,0x36,0x20,0x30,0xa,0x31,0x37,0x20,0x2d,0x33,0x33,0x20,0x2d,0x32,0x35,0x20,0x30,0xa,0x2d,0x38,0x20,0x2d,0x36,0x39,0x20,0x37,0x38,0x20,0x30,0xa,0x36,0x32,0x20,0x39,0x30,0x20,0x34,0x30,0x20,0x30,0xa,0x36,0x31,0x20,0x2d,0x33,0x31,0x20,0x2d,0x34,0x34,0x20,0x30,0xa,0x2d,0x37,0x35,0x20,0x38,0x39,0x20,0x35,0x38,0x20,0x30,0xa,0x2d,0x38,0x39,0x20,0x2d,0x31,0x38,0x20,0x38,0x33,0x20,0x30,0xa,0x38,0x30,0x20,0x36,0x34,0x20,0x36,0x32,0x20,0x30,0xa,0x2d,0x33,0x33,0x20,0x2d,0x32,0x39,0x20,0x31,0x32,0x20,0x30,0xa,0x32,0x33,0x20,0x38,0x38,0x20,0x2d,0x31,0x35,0x20,0x30,0xa,0x34,0x30,0x20,0x35,0x35,0x20,0x34,0x32,0x20,0x30,0xa,0x2d,0x37,0x39,0x20,0x32,0x39,0x20,0x2d,0x31,0x31,0x20,0x30,0xa,0x2d,0x34,0x34,0x20,0x33,0x35,0x20,0x37,0x37,0x20,0x30,0xa,0x34,0x35,0x20,0x2d,0x31,0x38,0x20,0x2d,0x31,0x35,0x20,0x30,0xa,0x36,0x20,0x2d,0x34,0x35,0x20,0x31,0x30,0x20,0x30,0xa,0x33,0x32,0x20,0x33,0x35,0x20,0x36,0x38,0x20,0x30,0xa,0x2d,0x35,0x32,0x20,0x34,0x38,0x20,0x2d,0x39,0x33,0x20,0x30,0xa,0x2d,0x33,0x36,0x20,0x2d,0x32,0x20,0x36,0x36,0x20,0x30,0xa,0x2d,0x38,0x33,0x20,0x2d,0x39,0x33,0x20,0x31,0x37,0x20,0x30,0xa,0x2d,0x38,0x37,0x20,0x37,0x34,0x20,0x38,0x30,0x20,0x30,0xa,0x2d,0x35,0x31,0x20,0x2d,0x33,0x39,0x20,0x32,0x39,0x20,0x30,0xa,0x36,0x36,0x20,0x2d,0x31,0x35,0x20,0x32,0x33,0x20,0x30,0xa,0x33,0x20,0x2d,0x33,0x33,0x20,0x36,0x39,0x20,0x30,0xa,0x2d,0x35,0x32,0x20,0x39,0x31,0x20,0x2d,0x31,0x34,0x20,0x30,0xa,0x2d,0x34,0x37,0x20,0x2d,0x37,0x30,0x20,0x2d,0x37,0x32,0x20,0x30,0xa,0x34,0x20,0x38,0x30,0x20,0x34,0x30,0x20,0x30,0xa,0x2d,0x37,0x35,0x20,0x31,0x39,0x20,0x2d,0x38,0x37,0x20,0x30,0xa,0x2d,0x39,0x39,0x20,0x34,0x33,0x20,0x2d,0x34,0x37,0x20,0x30,0xa,0x34,0x39,0x20,0x2d,0x35,0x37,0x20,0x35,0x32,0x20,0x30,0xa,0x2d,0x38,0x36,0x20,0x38,0x38,0x20,0x2d,0x38,0x32,0x20,0x30,0xa,0x2d,0x38,0x33,0x20,0x2d,0x31,0x37,0x20,0x34,0x39,0x20,0x30,0xa,0x2d,0x34,0x20,0x31,0x30,0x30,0x20,0x2d,0x35,0x36,0x20,0x30,0xa,0x35,0x33,0x20,0x35,0x32,0x20,0x2d,0x37,0x38,0x20,0x30,0xa,0x38,0x33,0x20,0x39,0x31,0x20,0x39,0x30,0x20,0x30,0xa,0x2d,0x31,0x38,0x20,0x2d,0x36,0x38,0x20,0x2d,0x36,0x36,0x20,0x30,0xa,0x2d,0x37,0x33,0x20,0x2d,0x38,0x34,0x20,0x34,0x36,0x20,0x30,0xa,0x2d,0x38,0x30,0x20,0x33,0x31,0x20,0x31,0x34,0x20,0x30,0xa,0x31,0x30,0x30,0x20,0x2d,0x36,0x20,0x39,0x31,0x20,0x30,0xa,0x2d,0x38,0x35,0x20,0x2d,0x38,0x31,0x20,0x39,0x39,0x20,0x30,0xa,0x2d,0x34,0x36,0x20,0x33,0x38,0x20,0x2d,0x39,0x37,0x20,0x30,0xa,0x38,0x32,0x20,0x37,0x39,0x20,0x36,0x37,0x20,0x30,0xa,0x2d,0x36,0x36,0x20,0x32,0x33,0x20,0x37,0x30,0x20,0x30,0xa,0x39,0x31,0x20,0x2d,0x31,0x36,0x20,0x37,0x35,0x20,0x30,0xa,0x32,0x33,0x20,0x35,0x31,0x20,0x2d,0x39,0x32,0x20,0x30,0xa,0x2d,0x34,0x33,0x20,0x38,0x35,0x20,0x33,0x32,0x20,0x30,0xa,0x2d,0x36,0x34,0x20,0x2d,0x38,0x34,0x20,0x39,0x39,0x20,0x30,0xa,0x2d,0x35,0x32,0x20,0x2d,0x37,0x30,0x20,0x2d,0x31,0x36,0x20,0x30,0xa,0x32,0x30,0x20,0x2d,0x32,0x20,0x2d,0x34,0x39,0x20,0x30,0xa,0x32,0x34,0x20,0x2d,0x35,0x39,0x20,0x2d,0x39,0x39,0x20,0x30,0xa,0x2d,0x32,0x30,0x20,0x36,0x38,0x20,0x31,0x34,0x20,0x30,0xa,0x2d,0x38,0x32,0x20,0x39,0x31,0x20,0x2d,0x39,0x35,0x20,0x30,0xa,0x2d,0x31,0x20,0x2d,0x37,0x30,0x20,0x2d,0x33,0x32,0x20,0x30,0xa,0x34,0x34,0x20,0x2d,0x38,0x35,0x20,0x2d,0x33,0x31,0x20,0x30,0xa,0x2d,0x32,0x31,0x20,0x2d,0x32,0x33,0x20,0x34,0x39,0x20,0x30,0xa,0x36,0x20,0x2d,0x36,0x37,0x20,0x2d,0x39,0x33,0x20,0x30,0xa,0x36,0x39,0x20,0x31,0x30,0x20,0x2d,0x33,0x32,0x20,0x30,0xa,0x2d,0x37,0x20,0x2d,0x35,0x30,0x20,0x31,0x32,0x20,0x30,0xa,0x36,0x37,0x20,0x2d,0x33,0x31,0x20,0x31,0x30,0x30,0x20,0x30,0xa,0x33,0x36,0x20,0x39,0x33,0x20,0x2d,0x35,0x34,0x20,0x30,0xa,0x2d,0x34,0x31,0x20,0x2d,0x39,0x39,0x20,0x2d,0x36,0x39,0x20,0x30,0xa,0x37,0x31,0x20,0x32,0x32,0x20,0x39,0x30,0x20,0x30,0xa,0x33,0x36,0x20,0x34,0x37,0x20,0x32,0x30,0x20,0x30,0xa,0x2d,0x39,0x33,0x20,0x38,0x30,0x20,0x31,0x31,0x20,0x30,0xa,0x33,0x33,0x20,0x34,0x35,0x20,0x35,0x30,0x20,0x30,0xa,0x31,0x37,0x20,0x2d,0x33,0x33,0x20,0x2d,0x32,0x39,0x20,0x30,0xa,0x2d,0x32,0x36,0x20,0x37,0x30,0x20,0x35,0x35,0x20,0x30,0xa,0x35,0x39,0x20,0x2d,0x35,0x31,0x20,0x39,0x32,0x20,0x30,0xa,0x2d,0x38,0x36,0x20,0x38,0x20,0x2d,0x34,0x20,0x30,0xa,0x2d,0x37,0x36,0x20,0x2d,0x37,0x37,0x20,0x2d,0x31,0x37,0x20,0x30,0xa,0x34,0x39,0x20,0x2d,0x31,0x38,0x20,0x33,0x37,0x20,0x30,0xa,0x39,0x36,0x20,0x32,0x33,0x20,0x32,0x39,0x20,0x30,0xa,0x2d,0x33,0x38,0x20,0x31,0x32,0x20,0x36,0x36,0x20,0x30,0xa,0x33,0x38,0x20,0x38,0x30,0x20,0x37,0x36,0x20,0x30,0xa,0x2d,0x38,0x30,0x20,0x38,0x20,0x2d,0x37,0x20,0x30,0xa,0x2d,0x38,0x31,0x20,0x2d,0x31,0x34,0x20,0x31,0x35,0x20,0x30,0xa,0x32,0x37,0x20,0x2d,0x36,0x35,0x20,0x2d,0x35,0x31,0x20,0x30,0xa,0x35,0x30,0x20,0x2d,0x38,0x35,0x20,0x36,0x37,0x20,0x30,0xa,0x2d,0x31,0x20,0x2d,0x39,0x32,0x20,0x2d,0x31,0x36,0x20,0x30,0xa,0x2d,0x38,0x35,0x20,0x36,0x32,0x20,0x2d,0x37,0x30,0x20,0x30,0xa,0x38,0x36,0x20,0x37,0x31,0x20,0x36,0x35,0x20,0x30,0xa,0x38,0x35,0x20,0x35,0x34,0x20,0x2d,0x35,0x32,0x20,0x30,0xa,0x31,0x37,0x20,0x2d,0x32,0x34,0x20,0x37,0x32,0x20,0x30,0xa,0x2d,0x35,0x31,0x20,0x39,0x34,0x20,0x36,0x39,0x20,0x30,0xa,0x31,0x30,0x20,0x38,0x37,0x20,0x39,0x36,0x20,0x30,0xa,0x32,0x33,0x20,0x2d,0x37,0x37,0x20,0x2d,0x36,0x35,0x20,0x30,0xa,0x2d,0x32,0x36,0x20,0x2d,0x33,0x30,0x20,0x2d,0x34,0x37,0x20,0x30,0xa,0x39,0x20,0x2d,0x34,0x34,0x20,0x37,0x20,0x30,0xa,0x31,0x39,0x20,0x2d,0x33,0x37,0x20,0x2d,0x36,0x31,0x20,0x30,0xa,0x2d,0x37,0x33,0x20,0x2d,0x35,0x31,0x20,0x2d,0x31,0x32,0x20,0x30,0xa,0x38,0x33,0x20,0x33,0x39,0x20,0x2d,0x35,0x31,0x20,0x30,0xa,0x37,0x20,0x37,0x31,0x20,0x2d,0x36,0x32,0x20,0x30,0xa,0x2d,0x32,0x30,0x20,0x2d,0x37,0x37,0x20,0x37,0x36,0x20,0x30,0xa,0x37,0x38,0x20,0x2d,0x31,0x30,0x30,0x20,0x2d,0x34,0x37,0x20,0x30,0xa,0x37,0x34,0x20,0x2d,0x37,0x35,0x20,0x31,0x35,0x20,0x30,0xa,0x2d,0x34,0x33,0x20,0x34,0x34,0x20,0x34,0x38,0x20,0x30,0xa,0x31,0x30,0x20,0x2d,0x36,0x33,0x20,0x38,0x32,0x20,0x30,0xa,0x2d,0x37,0x30,0x20,0x31,0x20,0x32,0x31,0x20,0x30,0xa,0x37,0x35,0x20,0x31,0x39,0x20,0x2d,0x37,0x36,0x20,0x30,0xa,0x2d,0x34,0x37,0x20,0x34,0x34,0x20,0x33,0x34,0x20,0x30,0xa,0x2d,0x38,0x31,0x20,0x33,0x32,0x20,0x33,0x34,0x20,0x30,0xa,0x2d,0x38,0x30,0x20,0x2d,0x31,0x31,0x20,0x2d,0x31,0x30,0x20,0x30,0xa,0x35,0x33,0x20,0x2d,0x31,0x31,0x20,0x31,0x37,0x20,0x30,0xa,0x2d,0x32,0x37,0x20,0x31,0x33,0x20,0x2d,0x33,0x36,0x20,0x30,0xa,0x2d,0x32,0x37,0x20,0x37,0x30,0x20,0x31,0x30,0x20,0x30,0xa,0x36,0x37,0x20,0x31,0x38,0x20,0x2d,0x35,0x20,0x30,0xa,0x2d,0x34,0x20,0x2d,0x34,0x31,0x20,0x35,0x34,0x20,0x30,0xa,0x2d,0x37,0x36,0x20,0x2d,0x39,0x30,0x20,0x38,0x35,0x20,0x30,0xa,0x2d,0x32,0x36,0x20,0x2d,0x33,0x30,0x20,0x2d,0x31,0x35,0x20,0x30,0xa,0x39,0x33,0x20,0x33,0x35,0x20,0x2d,0x35,0x39,0x20,0x30,0xa,0x34,0x33,0x20,0x2d,0x37,0x39,0x20,0x2d,0x39,0x33,0x20,0x30,0xa,0x32,0x20,0x2d,0x36,0x33,0x20,0x35,0x20,0x30,0xa,0x2d,0x33,0x30,0x20,0x39,0x38,0x20,0x2d,0x31,0x31,0x20,0x30,0xa,0x32,0x36,0x20,0x32,0x37,0x20,0x35,0x37,0x20,0x30,0xa,0x35,0x31,0x20,0x38,0x34,0x20,0x2d,0x31,0x30,0x20,0x30,0xa,0x2d,0x33,0x39,0x20,0x37,0x35,0x20,0x35,0x35,0x20,0x30,0xa,0x2d,0x31,0x34,0x20,0x2d,0x38,0x35,0x20,0x2d,0x38,0x31,0x20,0x30,0xa,0x39,0x31,0x20,0x2d,0x37,0x35,0x20,0x34,0x34,0x20,0x30,0xa,0x2d,0x36,0x36,0x20,0x2d,0x36,0x34,0x20,0x2d,0x37,0x38,0x20,0x30,0xa,0x2d,0x36,0x32,0x20,0x2d,0x37,0x37,0x20,0x2d,0x38,0x38,0x20,0x30,0xa,0x2d,0x37,0x38,0x20,0x2d,0x36,0x31,0x20,0x2d,0x32,0x32,0x20,0x30,0xa,0x2d,0x37,0x33,0x20,0x39,0x38,0x20,0x35,0x31,0x20,0x30,0xa,0x2d,0x37,0x38,0x20,0x39,0x37,0x20,0x36,0x20,0x30,0xa,0x2d,0x36,0x36,0x20,0x2d,0x35,0x37,0x20,0x2d,0x32,0x37,0x20,0x30,0xa,0x2d,0x38,0x31,0x20,0x31,0x39,0x20,0x35,0x30,0x20,0x30,0xa,0x2d,0x32,0x20,0x33,0x33,0x20,0x39,0x37,0x20,0x30,0xa,0x2d,0x34,0x32,0x20,0x2d,0x34,0x34,0x20,0x2d,0x34,0x30,0x20,0x30,0xa,0x32,0x37,0x20,0x2d,0x39,0x32,0x20,0x2d,0x31,0x31,0x20,0x30,0xa,0x2d,0x39,0x20,0x2d,0x31,0x37,0x20,0x2d,0x31,0x30,0x30,0x20,0x30,0xa,0x2d,0x33,0x30,0x20,0x34,0x20,0x2d,0x38,0x33,0x20,0x30,0xa,0x2d,0x36,0x35,0x20,0x39,0x36,0x20,0x37,0x34,0x20,0x30,0xa,0x2d,0x36,0x38,0x20,0x36,0x30,0x20,0x31,0x30,0x20,0x30,0xa,0x2d,0x36,0x20,0x38,0x30,0x20,0x33,0x31,0x20,0x30,0xa,0x2d,0x32,0x37,0x20,0x38,0x30,0x20,0x2d,0x32,0x30,0x20,0x30,0xa,0x2d,0x34,0x37,0x20,0x31,0x20,0x39,0x32,0x20,0x30,0xa,0x2d,0x38,0x37,0x20,0x31,0x39,0x20,0x34,0x20,0x30,0xa,0x2d,0x36,0x36,0x20,0x36,0x33,0x20,0x2d,0x34,0x31,0x20,0x30,0xa,0x37,0x31,0x20,0x2d,0x38,0x35,0x20,0x2d,0x33,0x36,0x20,0x30,0xa,0x2d,0x38,0x32,0x20,0x2d,0x36,0x33,0x20,0x2d,0x31,0x35,0x20,0x30,0xa,0x39,0x36,0x20,0x33,0x34,0x20,0x35,0x36,0x20,0x30,0xa,0x36,0x36,0x20,0x32,0x31,0x20,0x2d,0x31,0x37,0x20,0x30,0xa,0x32,0x38,0x20,0x2d,0x31,0x20,0x2d,0x38,0x37,0x20,0x30,0xa,0x39,0x20,0x38,0x20,0x2d,0x32,0x20,0x30,0xa,0x37,0x39,0x20,0x32,0x20,0x37,0x32,0x20,0x30,0xa,0x2d,0x37,0x31,0x20,0x36,0x37,0x20,0x33,0x33,0x20,0x30,0xa,0x2d,0x38,0x20,0x33,0x31,0x20,0x37,0x32,0x20,0x30,0xa,0x31,0x36,0x20,0x2d,0x33,0x20,0x2d,0x37,0x33,0x20,0x30,0xa,0x32,0x38,0x20,0x2d,0x32,0x39,0x20,0x32,0x33,0x20,0x30,0xa,0x34,0x31,0x20,0x39,0x33,0x20,0x31,0x39,0x20,0x30,0xa,0x39,0x36,0x20,0x33,0x37,0x20,0x34,0x35,0x20,0x30,0xa,0x33,0x30,0x20,0x38,0x36,0x20,0x2d,0x32,0x34,0x20,0x30,0xa,0x31,0x35,0x20,0x31,0x32,0x20,0x39,0x36,0x20,0x30,0xa,0x35,0x35,0x20,0x33,0x32,0x20,0x39,0x33,0x20,0x30,0xa,0x2d,0x34,0x35,0x20,0x2d,0x34,0x36,0x20,0x2d,0x35,0x39,0x20,0x30,0xa,0x34,0x39,0x20,0x2d,0x38,0x37,0x20,0x2d,0x35,0x30,0x20,0x30,0xa,0x2d,0x36,0x33,0x20,0x34,0x34,0x20,0x32,0x33,0x20,0x30,0xa,0x35,0x36,0x20,0x2d,0x33,0x36,0x20,0x36,0x39,0x20,0x30,0xa,0x34,0x38,0x20,0x35,0x33,0x20,0x2d,0x35,0x39,0x20,0x30,0xa,0x36,0x36,0x20,0x33,0x20,0x2d,0x34,0x38,0x20,0x30,0xa,0x37,0x31,0x20,0x39,0x32,0x20,0x2d,0x39,0x34,0x20,0x30,0xa,0x2d,0x31,0x38,0x20,0x32,0x31,0x20,0x31,0x31,0x20,0x30,0xa,0x2d,0x34,0x31,0x20,0x32,0x32,0x20,0x33,0x36,0x20,0x30,0xa,0x2d,0x37,0x31,0x20,0x2d,0x34,0x36,0x20,0x2d,0x35,0x38,0x20,0x30,0xa,0x39,0x20,0x38,0x38,0x20,0x32,0x34,0x20,0x30,0xa,0x2d,0x32,0x35,0x20,0x38,0x34,0x20,0x2d,0x34,0x36,0x20,0x30,0xa,0x2d,0x34,0x36,0x20,0x36,0x35,0x20,0x2d,0x38,0x31,0x20,0x30,0xa,0x2d,0x32,0x34,0x20,0x2d,0x34,0x39,0x20,0x2d,0x35,0x20,0x30,0xa,0x2d,0x32,0x37,0x20,0x38,0x20,0x2d,0x33,0x32,0x20,0x30,0xa,0x33,0x32,0x20,0x2d,0x34,0x37,0x20,0x2d,0x39,0x39,0x20,0x30,0xa,0x2d,0x31,0x20,0x32,0x36,0x20,0x2d,0x31,0x33,0x20,0x30,0xa,0x33,0x35,0x20,0x31,0x39,0x20,0x2d,0x32,0x31,0x20,0x30,0xa,0x2d,0x37,0x30,0x20,0x37,0x37,0x20,0x2d,0x35,0x36,0x20,0x30,0xa,0x32,0x34,0x20,0x2d,0x36,0x36,0x20,0x34,0x36,0x20,0x30,0xa,0x33,0x30,0x20,0x39,0x38,0x20,0x31,0x39,0x20,0x30,0xa,0x2d,0x34,0x37,0x20,0x32,0x34,0x20,0x37,0x20,0x30,0xa,0x39,0x30,0x20,0x2d,0x32,0x38,0x20,0x2d,0x31,0x32,0x20,0x30,0xa,0x2d,0x32,0x32,0x20,0x2d,0x37,0x34,0x20,0x2d,0x38,0x39,0x20,0x30,0xa,0x2d,0x33,0x20,0x2d,0x32,0x38,0x20,0x2d,0x34,0x31,0x20,0x30,0xa,0x34,0x37,0x20,0x36,0x34,0x20,0x2d,0x37,0x32,0x20,0x30,0xa,0x2d,0x38,0x36,0x20,0x39,0x35,0x20,0x37,0x33,0x20,0x30,0xa,0x37,0x34,0x20,0x2d,0x31,0x32,0x20,0x36,0x32,0x20,0x30,0xa,0x38,0x35,0x20,0x38,0x33,0x20,0x34,0x32,0x20,0x30,0xa,0x2d,0x34,0x31,0x20,0x2d,0x33,0x34,0x20,0x33,0x33,0x20,0x30,0xa,0x2d,0x32,0x20,0x33,0x38,0x20,0x32,0x31,0x20,0x30,0xa,0x37,0x39,0x20,0x2d,0x32,0x38,0x20,0x2d,0x33,0x36,0x20,0x30,0xa,0x37,0x34,0x20,0x33,0x37,0x20,0x37,0x38,0x20,0x30,0xa,0x2d,0x31,0x33,0x20,0x2d,0x35,0x31,0x20,0x2d,0x34,0x36,0x20,0x30,0xa,0x2d,0x35,0x31,0x20,0x2d,0x35,0x38,0x20,0x32,0x30,0x20,0x30,0xa,0x39,0x34,0x20,0x38,0x32,0x20,0x2d,0x33,0x32,0x20,0x30,0xa,0x2d,0x36,0x31,0x20,0x2d,0x37,0x33,0x20,0x2d,0x36,0x32,0x20,0x30,0xa,0x37,0x33,0x20,0x39,0x31,0x20,0x2d,0x36,0x34,0x20,0x30,0xa,0x2d,0x39,0x35,0x20,0x35,0x38,0x20,0x2d,0x32,0x32,0x20,0x30,0xa,0x34,0x38,0x20,0x2d,0x34,0x36,0x20,0x2d,0x35,0x37,0x20,0x30,0xa,0x2d,0x31,0x32,0x20,0x35,0x37,0x20,0x39,0x38,0x20,0x30,0xa,0x36,0x20,0x2d,0x34,0x37,0x20,0x2d,0x37,0x33,0x20,0x30,0xa,0x36,0x32,0x20,0x2d,0x32,0x20,0x37,0x34,0x20,0x30,0xa,0x38,0x34,0x20,0x32,0x31,0x20,0x36,0x36,0x20,0x30,0xa,0x2d,0x34,0x31,0x20,0x33,0x34,0x20,0x31,0x38,0x20,0x30,0xa,0x39,0x35,0x20,0x2d,0x38,0x30,0x20,0x36,0x38,0x20,0x30,0xa,0x35,0x39,0x20,0x2d,0x36,0x36,0x20,0x2d,0x37,0x31,0x20,0x30,0xa,0x34,0x30,0x20,0x37,0x36,0x20,0x32,0x37,0x20,0x30,0xa,0x34,0x34,0x20,0x2d,0x31,0x36,0x20,0x2d,0x35,0x35,0x20,0x30,0xa,0x2d,0x38,0x30,0x20,0x35,0x37,0x20,0x2d,0x35,0x38,0x20,0x30,0xa,0x37,0x20,0x2d,0x31,0x31,0x20,0x39,0x33,0x20,0x30,0xa,0x35,0x31,0x20,0x2d,0x32,0x34,0x20,0x36,0x31,0x20,0x30,0xa,0x32,0x35,0x20,0x37,0x36,0x20,0x35,0x38,0x20,0x30,0xa,0x39,0x37,0x20,0x2d,0x32,0x33,0x20,0x37,0x37,0x20,0x30,0xa,0x2d,0x38,0x20,0x2d,0x38,0x36,0x20,0x39,0x20,0x30,0xa,0x2d,0x34,0x31,0x20,0x35,0x37,0x20,0x34,0x33,0x20,0x30,0xa,0x36,0x30,0x20,0x2d,0x33,0x36,0x20,0x35,0x33,0x20,0x30,0xa,0x2d,0x37,0x30,0x20,0x35,0x35,0x20,0x37,0x39,0x20,0x30,0xa,0x2d,0x31,0x39,0x20,0x34,0x35,0x20,0x2d,0x31,0x38,0x20,0x30,0xa,0x2d,0x32,0x38,0x20,0x35,0x39,0x20,0x38,0x34,0x20,0x30,0xa,0x2d,0x37,0x20,0x2d,0x35,0x39,0x20,0x2d,0x32,0x30,0x20,0x30,0xa,0x35,0x31,0x20,0x32,0x20,0x2d,0x35,0x30,0x20,0x30,0xa,0x33,0x39,0x20,0x2d,0x38,0x33,0x20,0x37,0x35,0x20,0x30,0xa,0x31,0x33,0x20,0x36,0x33,0x20,0x2d,0x32,0x34,0x20,0x30,0xa,0x2d,0x36,0x39,0x20,0x2d,0x34,0x31,0x20,0x2d,0x36,0x34,0x20,0x30,0xa,0x2d,0x39,0x33,0x20,0x2d,0x37,0x35,0x20,0x34,0x31,0x20,0x30,0xa,0x2d,0x38,0x39,0x20,0x35,0x31,0x20,0x2d,0x36,0x39,0x20,0x30,0xa,0x2d,0x37,0x37,0x20,0x2d,0x33,0x32,0x20,0x2d,0x37,0x20,0x30,0xa,0x34,0x33,0x20,0x35,0x34,0x20,0x2d,0x34,0x20,0x30,0xa,0x2d,0x38,0x35,0x20,0x2d,0x35,0x33,0x20,0x32,0x37,0x20,0x30,0xa,0x2d,0x32,0x39,0x20,0x34,0x31,0x20,0x2d,0x35,0x31,0x20,0x30,0xa,0x2d,0x32,0x20,0x2d,0x35,0x30,0x20,0x2d,0x38,0x34,0x20,0x30,0xa,0x31,0x30,0x30,0x20,0x2d,0x37,0x39,0x20,0x32,0x39,0x20,0x30,0xa,0x32,0x37,0x20,0x39,0x31,0x20,0x33,0x38,0x20,0x30,0xa,0x2d,0x35,0x33,0x20,0x2d,0x32,0x30,0x20,0x2d,0x31,0x35,0x20,0x30,0xa,0x39,0x37,0x20,0x34,0x34,0x20,0x2d,0x31,0x39,0x20,0x30,0xa,0x2d,0x39,0x30,0x20,0x36,0x37,0x20,0x33,0x36,0x20,0x30,0xa};
\ No newline at end of file
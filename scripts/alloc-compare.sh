@@ -0,0 +1,31 @@
+#!/bin/bash
+#
+# Compare the libmin allocator variants (ALLOC=malloc, arena, pool) on the
+# node-heavy benchmarks. Each variant is built for TARGET=host, validated
+# against the benchmark's reference output, and its runtime is reported from
+# the TARGET_PERFHOOKS "PERF:" line (benchmarks without perf hooks show "-").
+#
+# usage: scripts/alloc-compare.sh [benchmark ...]
+#
+
+cd "$(dirname "$0")/.."
+
+if [ $# -gt 0 ] ; then
+  BMARKS="$@"
+else
+  BMARKS="avl-tree graph-tests huff-encode priority-queue topo-sort"
+fi
+
+printf "%-20s %-8s %-6s %10s\n" "benchmark" "alloc" "test" "perf(us)"
+for _BMARK in $BMARKS ; do
+  for _ALLOC in malloc arena pool ; do
+    if make -C $_BMARK TARGET=host ALLOC=$_ALLOC clean build test > /dev/null 2>&1 ; then
+      STATUS="ok"
+    else
+      STATUS="FAILED"
+    fi
+    PERF=$(cd $_BMARK && ./$_BMARK.host 2>&1 > /dev/null | sed -n 's/^PERF: program ran for \([0-9]*\) us.*/\1/p')
+    printf "%-20s %-8s %-6s %10s\n" $_BMARK $_ALLOC $STATUS ${PERF:--}
+  done
+  make -C $_BMARK TARGET=host clean > /dev/null 2>&1
+done
@@ -0,0 +1,55 @@
+#!/bin/bash
+#
+# Measure the peak heap footprint of each benchmark and check it against a
+# target heap budget. Benchmarks are built for TARGET=host with MALLOC_STATS=1,
+# and the "HEAP:" report printed at libmin_success() is parsed for the peak
+# footprint (payload plus malloc headers, i.e., what libtarg_sbrk() must supply).
+#
+# usage: scripts/heap-budget.sh [budget-bytes] [benchmark ...]
+#
+# The default budget is 32768 bytes, the MAX_HEAP of the bare-metal targets
+# (see target/libtarg.c). The last line of output is a list of benchmarks that
+# exceed the budget, in a form suitable for a TARGET_EXCLUDES definition.
+#
+# Note that host malloc headers are larger than on 32-bit targets, so footprints
+# are slightly conservative for RV32 targets.
+#
+
+BUDGET=${1:-32768}
+shift
+
+cd "$(dirname "$0")/.."
+
+if [ $# -gt 0 ] ; then
+  BMARKS="$@"
+else
+  BMARKS=$(sed -n 's/^BMARKS = //p' Makefile)
+fi
+
+OVER=""
+printf "%-24s %12s %12s %8s  %s\n" "benchmark" "peak-live" "peak-heap" "allocs" "status"
+for _BMARK in $BMARKS ; do
+  make -C $_BMARK TARGET=host MALLOC_STATS=1 clean build > /dev/null 2>&1
+  if [ $? -ne 0 ] ; then
+    printf "%-24s %12s %12s %8s  %s\n" $_BMARK "-" "-" "-" "BUILD-FAILED"
+    continue
+  fi
+  REPORT=$(cd $_BMARK && ./$_BMARK.host 2> /dev/null | grep 'HEAP:')
+  LIVE=$(echo "$REPORT" | sed -n 's/.*peak live \([0-9]*\) bytes.*/\1/p')
+  PEAK=$(echo "$REPORT" | sed -n 's/.*peak footprint \([0-9]*\) bytes.*/\1/p')
+  ALLOCS=$(echo "$REPORT" | sed -n 's/.*HEAP: mallocs \([0-9]*\), callocs \([0-9]*\), reallocs \([0-9]*\).*/\1 \2 \3/p' | awk '{ print $1+$2+$3 }')
+  if [ -z "$PEAK" ] ; then
+    printf "%-24s %12s %12s %8s  %s\n" $_BMARK "-" "-" "-" "NO-REPORT"
+    continue
+  fi
+  if [ $PEAK -gt $BUDGET ] ; then
+    STATUS="OVER"
+    OVER="$OVER $_BMARK"
+  else
+    STATUS="ok"
+  fi
+  printf "%-24s %12s %12s %8s  %s\n" $_BMARK $LIVE $PEAK $ALLOCS $STATUS
+  make -C $_BMARK TARGET=host clean > /dev/null 2>&1
+done
+
+echo "HEAP_EXCLUDES ($BUDGET bytes) =$OVER"
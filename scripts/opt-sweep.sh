@@ -0,0 +1,133 @@
+#!/bin/bash
+#
+# Sweep the benchmark suite over a matrix of compilers x optimization levels x
+# targets. Each cell of the matrix is built and run in its own copy of the
+# source tree (under $SWEEP_DIR), so cells do not share objects or libmin.a and
+# may run in parallel. Every benchmark is validated against its reference
+# output, and its code size and test runtime are recorded.
+#
+# usage: scripts/opt-sweep.sh
+#
+# The matrix is configured with the following environment variables:
+#   SWEEP_CCS     - compilers, passed as TARGET_CC (default: "gcc")
+#   SWEEP_OPTS    - optimization flags, passed as OPT (default: "-O0 -O1 -O2 -O3 -Os")
+#   SWEEP_TARGETS - TARGET modes (default: "host")
+#   SWEEP_BMARKS  - benchmarks to run (default: all benchmarks of each target)
+#   SWEEP_JOBS    - number of cells to run in parallel (default: 1)
+#   SWEEP_DIR     - output directory (default: _sweep, which "make all-clean"
+#                   deletes)
+#
+# For example, to compare gcc and clang at -O2 and -O3 on the host:
+#   SWEEP_CCS="gcc clang" SWEEP_OPTS="-O2 -O3" scripts/opt-sweep.sh
+#
+# Results are written to $SWEEP_DIR/results.csv (one line per benchmark per
+# cell) and $SWEEP_DIR/summary.txt (one line per cell, with size and time
+# deltas relative to the first cell of the same target). The text and time
+# totals are over the benchmarks that pass in the cell, the deltas over the
+# benchmarks that pass in both the cell and the first cell ("common"), so they
+# compare the same set of benchmarks. Time is the wall-clock time of the
+# benchmark's "test" run, including any simulator start-up.
+#
+
+SWEEP_CCS=${SWEEP_CCS:-gcc}
+SWEEP_OPTS=${SWEEP_OPTS:--O0 -O1 -O2 -O3 -Os}
+SWEEP_TARGETS=${SWEEP_TARGETS:-host}
+SWEEP_JOBS=${SWEEP_JOBS:-1}
+SWEEP_DIR=${SWEEP_DIR:-_sweep}
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+mkdir -p "$SWEEP_DIR"
+SWEEP_DIR=$(cd "$SWEEP_DIR" && pwd)
+
+# run all benchmarks of one cell: run_cell <cell-dir> <target> <cc> <opt>
+run_cell()
+{
+  local CELL=$1 TARGET=$2 CC=$3 OPT=$4
+  local BMARKS STATUS START END SIZE
+
+  # isolated copy of the source tree, without build products
+  rm -rf "$CELL"
+  mkdir -p "$CELL/tree"
+  tar -C "$ROOT" --exclude=.git --exclude="$(basename "$SWEEP_DIR")" --exclude='*.o' --exclude='*.a' \
+    --exclude='*.host' --exclude='*.sa' --exclude='*.elf' --exclude='*.hahost' --exclude='*.haspike' \
+    -cf - . | tar -C "$CELL/tree" -xf -
+
+  BMARKS=${SWEEP_BMARKS:-$(make -s -C "$CELL/tree" TARGET=$TARGET list-bmarks)}
+  for _BMARK in $BMARKS ; do
+    cd "$CELL/tree/$_BMARK"
+    SIZE="- - -"
+    if ! make TARGET=$TARGET TARGET_CC="$CC" OPT="$OPT" clean build > "$CELL/$_BMARK.log" 2>&1 ; then
+      STATUS="BUILD-FAILED"
+      END=0 START=0
+    else
+      SIZE=$(make -s TARGET=$TARGET TARGET_CC="$CC" OPT="$OPT" size 2> /dev/null | awk '{ print $1, $2, $3 }')
+      START=$(date +%s%N)
+      if make TARGET=$TARGET TARGET_CC="$CC" OPT="$OPT" test >> "$CELL/$_BMARK.log" 2>&1 ; then
+        STATUS="ok"
+      else
+        STATUS="FAILED"
+      fi
+      END=$(date +%s%N)
+    fi
+    echo "$TARGET,$CC,$OPT,$_BMARK,$STATUS,$(echo $SIZE | tr ' ' ','),$(( (END - START) / 1000000 ))" >> "$CELL/results.csv"
+  done
+  rm -rf "$CELL/tree"
+}
+
+# launch all cells
+CELLS=""
+for _TARGET in $SWEEP_TARGETS ; do
+  for _CC in $SWEEP_CCS ; do
+    for _OPT in $SWEEP_OPTS ; do
+      CELL="$SWEEP_DIR/$_TARGET-$(echo "$_CC" | tr ' /=' '___')$(echo "$_OPT" | tr ' /=' '___')"
+      CELLS="$CELLS $CELL"
+      echo "Sweeping TARGET=$_TARGET TARGET_CC=\"$_CC\" OPT=\"$_OPT\" in $CELL"
+      run_cell "$CELL" "$_TARGET" "$_CC" "$_OPT" &
+      while [ $(jobs -r | wc -l) -ge $SWEEP_JOBS ] ; do
+        wait -n
+      done
+    done
+  done
+done
+wait
+
+# tabulate results
+echo "target,cc,opt,benchmark,status,text,data,bss,time_ms" > "$SWEEP_DIR/results.csv"
+for CELL in $CELLS ; do
+  cat "$CELL/results.csv" >> "$SWEEP_DIR/results.csv"
+done
+
+awk -F, '
+  NR == 1 { next }
+  {
+    cell = $1 SUBSEP $2 SUBSEP $3
+    if (!(cell in seen)) { seen[cell] = 1; order[ncells++] = cell }
+    total[cell]++
+    benches[cell] = benches[cell] SUBSEP $4
+    if ($5 == "ok") {
+      pass[cell]++; text[cell] += $6; ms[cell] += $9
+      ok[cell, $4] = 1; btext[cell, $4] = $6; bms[cell, $4] = $9
+    }
+  }
+  END {
+    printf "%-14s %-12s %-8s %9s %10s %10s %7s %8s %8s\n", "target", "cc", "opt", "pass", "text", "time(ms)", "common", "text", "time"
+    for (i = 0; i < ncells; i++) {
+      cell = order[i]
+      split(cell, key, SUBSEP)
+      if (!(key[1] in base)) base[key[1]] = cell
+      b = base[key[1]]
+
+      # deltas over the benchmarks that pass in both this cell and the base cell
+      n = split(benches[cell], names, SUBSEP)
+      common = 0; ct = 0; cbt = 0; cm = 0; cbm = 0
+      for (j = 2; j <= n; j++) {
+        if (!((cell, names[j]) in ok) || !((b, names[j]) in ok)) continue
+        common++
+        ct += btext[cell, names[j]]; cbt += btext[b, names[j]]
+        cm += bms[cell, names[j]]; cbm += bms[b, names[j]]
+      }
+      dtext = cbt ? sprintf("%+.1f%%", 100.0 * (ct - cbt) / cbt) : "-"
+      dms = cbm ? sprintf("%+.1f%%", 100.0 * (cm - cbm) / cbm) : "-"
+      printf "%-14s %-12s %-8s %4d/%-4d %10d %10d %7d %8s %8s\n", key[1], key[2], key[3], pass[cell], total[cell], text[cell], ms[cell], common, dtext, dms
+    }
+  }' "$SWEEP_DIR/results.csv" | tee "$SWEEP_DIR/summary.txt"
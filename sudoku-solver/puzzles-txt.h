@@ -0,0 +1,2 @@
+#define __puzzles_sz 3936
+const uint8_t __puzzles[3936] = {0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x39,0x2e,0x32,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x35,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x36,0x38,0x2e,0x2e,0x38,0x35,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0xa,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x35,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x33,0x2e,0x37,0x2e,0x35,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0xa,0x35,0x32,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x31,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x38,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x31,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x38,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0xa,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x33,0x2e,0x34,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x34,0x2e,0x37,0x2e,0x33,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0xa,0x34,0x38,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x31,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x37,0x36,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0xa,0x2e,0x2e,0x2e,0x2e,0x31,0x34,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x33,0x2e,0x36,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x38,0x2e,0x2e,0x2e,0xa,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x39,0x2e,0x34,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x35,0x2e,0x39,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x35,0x2e,0x2e,0x34,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x39,0x2e,0x38,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0xa,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x35,0x2e,0x2e,0x2e,0x33,0x31,0x35,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x31,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x33,0x38,0x2e,0x2e,0x35,0x33,0x37,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x32,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x32,0x34,0xa,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x36,0x38,0x2e,0x32,0x2e,0x38,0x2e,0x35,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x32,0x2e,0x35,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x33,0x2e,0x2e,0x32,0x2e,0x31,0x2e,0x2e,0x38,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x35,0x31,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0xa,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x35,0x2e,0x2e,0x36,0x31,0x2e,0x37,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x34,0x33,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x39,0x2e,0x2e,0x35,0x2e,0x2e,0x33,0x2e,0x2e,0x35,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x37,0x2e,0x2e,0x35,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x34,0xa,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x36,0x39,0x2e,0x33,0x32,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x37,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x39,0x2e,0x2e,0x33,0x2e,0x32,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x36,0x2e,0x32,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x31,0x2e,0x2e,0x38,0x35,0x2e,0x2e,0x32,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0xa,0x2e,0x37,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x35,0x2e,0x33,0x2e,0x2e,0x38,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x35,0x2e,0x36,0x2e,0x35,0x39,0x2e,0x37,0x36,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x35,0x39,0x31,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x33,0x34,0x2e,0x2e,0x2e,0xa,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x37,0x2e,0x33,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x33,0x38,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x33,0x2e,0x2e,0x32,0x2e,0x37,0x31,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x36,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x36,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0xa,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x32,0x2e,0x36,0x39,0x2e,0x31,0x2e,0x2e,0x33,0x2e,0x34,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x37,0x39,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x39,0x2e,0x35,0x2e,0x38,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x31,0x36,0x2e,0x2e,0x39,0x2e,0x34,0x2e,0x2e,0xa,0x2e,0x2e,0x2e,0x37,0x2e,0x33,0x2e,0x34,0x32,0x2e,0x2e,0x2e,0x2e,0x34,0x32,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x39,0x2e,0x2e,0x31,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x32,0x2e,0x36,0x33,0x2e,0x37,0x2e,0x2e,0x2e,0x36,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x35,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x35,0x2e,0x31,0x2e,0x2e,0x2e,0xa,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x38,0x38,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x34,0x2e,0x39,0x31,0x2e,0x2e,0x37,0x34,0x36,0x39,0x2e,0x2e,0x37,0x36,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x37,0x2e,0x2e,0x36,0x2e,0x2e,0x31,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x38,0x37,0xa,0x37,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x36,0x31,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x32,0x39,0x2e,0x34,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x37,0x2e,0x2e,0x35,0x2e,0x32,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x31,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x36,0x34,0x2e,0x2e,0x2e,0x33,0x37,0x2e,0x2e,0xa,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x33,0x31,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x36,0x39,0x2e,0x2e,0x2e,0x37,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x38,0x32,0x36,0x31,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x35,0x2e,0x36,0x2e,0x37,0x37,0x2e,0x2e,0x2e,0x38,0x2e,0x31,0x35,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0xa,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x31,0x2e,0x2e,0x32,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x34,0x2e,0x2e,0x39,0x2e,0x36,0x2e,0x2e,0x2e,0x33,0x2e,0x36,0x37,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x36,0x34,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x31,0x2e,0x37,0x2e,0x2e,0xa,0x31,0x36,0x2e,0x2e,0x2e,0x35,0x33,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x39,0x36,0x2e,0x2e,0x38,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x37,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x31,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x39,0x33,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x31,0x2e,0x36,0x34,0xa,0x2e,0x35,0x2e,0x2e,0x38,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x31,0x38,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x35,0x39,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x31,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x39,0x2e,0x2e,0x34,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x33,0x2e,0xa,0x35,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x31,0x36,0x2e,0x37,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x32,0x2e,0x35,0x33,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x35,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x33,0x36,0x2e,0x2e,0x31,0x2e,0x2e,0x32,0x39,0x2e,0x2e,0x2e,0x37,0xa,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x37,0x2e,0x32,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x31,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x38,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x39,0x34,0x2e,0x2e,0x34,0x38,0x32,0x35,0x2e,0x36,0x2e,0x37,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0xa,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x38,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x32,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x36,0x2e,0x39,0x2e,0x2e,0x2e,0x34,0x2e,0x31,0x2e,0x33,0x2e,0x36,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x39,0x2e,0x2e,0x38,0x2e,0x31,0x2e,0x33,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x39,0x2e,0x2e,0x2e,0x38,0xa,0x39,0x35,0x31,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x39,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x31,0x37,0x2e,0x2e,0x38,0x2e,0x32,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x34,0x2e,0x2e,0x33,0x2e,0x36,0x2e,0x34,0x2e,0x2e,0x35,0x31,0xa,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x36,0x39,0x2e,0x31,0x32,0x2e,0x2e,0x2e,0x34,0x31,0x2e,0x2e,0x33,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x32,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x38,0x2e,0x2e,0x31,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x36,0x2e,0x2e,0x32,0x2e,0x35,0x2e,0x2e,0x38,0x32,0x2e,0x2e,0x2e,0x36,0x39,0x2e,0x34,0x2e,0xa,0x2e,0x2e,0x33,0x32,0x2e,0x35,0x2e,0x2e,0x31,0x2e,0x38,0x31,0x2e,0x33,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x35,0x39,0x36,0x35,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x34,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x31,0x33,0xa,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x37,0x34,0x2e,0x2e,0x32,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x33,0x37,0x2e,0x2e,0x2e,0x31,0x31,0x36,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x33,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x38,0xa,0x33,0x2e,0x2e,0x2e,0x2e,0x31,0x32,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x32,0x31,0x2e,0x38,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x32,0x33,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x37,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x35,0x2e,0x2e,0x33,0x35,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0xa,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x35,0x34,0x2e,0x2e,0x2e,0x39,0x2e,0x32,0x2e,0x2e,0x39,0x2e,0x35,0x2e,0x2e,0x38,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x32,0x32,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x39,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x36,0x2e,0x35,0x34,0x2e,0x37,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x39,0x34,0x2e,0x2e,0x2e,0x2e,0xa,0x31,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x34,0x33,0x2e,0x39,0x31,0x2e,0x2e,0x2e,0x38,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x33,0x2e,0x38,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x33,0x2e,0x39,0x35,0x2e,0x34,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x38,0x36,0x2e,0x2e,0xa,0x2e,0x2e,0x2e,0x36,0x2e,0x34,0x2e,0x37,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x31,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x31,0x37,0x35,0x34,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x31,0x34,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x36,0x35,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x39,0xa,0x31,0x36,0x2e,0x2e,0x2e,0x37,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x36,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x32,0x2e,0x34,0x2e,0x2e,0x36,0x2e,0x37,0x2e,0x2e,0x2e,0x36,0x38,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x34,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x35,0x37,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0xa,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x36,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x38,0x34,0x37,0x2e,0x36,0x2e,0x2e,0x37,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x35,0x37,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x38,0x32,0x2e,0x36,0x2e,0x2e,0x38,0x35,0x2e,0x34,0xa,0x38,0x2e,0x2e,0x2e,0x37,0x2e,0x31,0x2e,0x2e,0x2e,0x39,0x2e,0x32,0x2e,0x2e,0x36,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x34,0x34,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x38,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x37,0x37,0x2e,0x2e,0x2e,0x2e,0x33,0x39,0x2e,0x2e,0x2e,0x2e,0x31,0x34,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x32,0x2e,0xa,0x31,0x37,0x2e,0x2e,0x35,0x33,0x38,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x36,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x33,0x37,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x38,0x39,0x36,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x34,0x2e,0x36,0xa,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x37,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x38,0x2e,0x2e,0x2e,0x36,0x33,0x2e,0x38,0x2e,0x2e,0x2e,0x31,0x32,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x31,0x2e,0x37,0x38,0x2e,0x39,0x33,0x2e,0x2e,0x2e,0x32,0x33,0x2e,0x34,0x36,0x2e,0x2e,0x2e,0x37,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x39,0x38,0x2e,0x37,0x2e,0x2e,0x2e,0xa,0x2e,0x2e,0x37,0x31,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x37,0x2e,0x33,0x2e,0x32,0x2e,0x34,0x32,0x38,0x2e,0x39,0x2e,0x35,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x38,0x32,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x37,0x2e,0x32,0x2e,0x34,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0xa,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x32,0x33,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x31,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x33,0x37,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x35,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x32,0x2e,0x36,0x2e,0x31,0x2e,0x38,0x2e,0x2e,0x2e,0x35,0x34,0x2e,0x2e,0x2e,0x2e,0xa,0x2e,0x2e,0x35,0x38,0x31,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x35,0x2e,0x2e,0x33,0x36,0x2e,0x34,0x2e,0x2e,0x2e,0x37,0x2e,0x36,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x37,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x36,0x31,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x37,0x2e,0x2e,0x31,0x33,0xa,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x36,0x2e,0x2e,0x32,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x37,0x35,0x31,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x39,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x34,0x2e,0x37,0x2e,0x2e,0x38,0x2e,0x32,0x33,0x2e,0x2e,0x39,0x35,0x2e,0x2e,0x31,0x37,0x2e,0xa,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x31,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x39,0x36,0x37,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x35,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x39,0x2e,0x32,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x36,0x38,0x2e,0x32,0x2e,0x33,0x2e,0x2e,0x2e,0x35,0xa,0x2e,0x33,0x2e,0x37,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x35,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x38,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x38,0x2e,0x2e,0x32,0x37,0x2e,0x39,0x2e,0x2e,0x35,0x37,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x33,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x36,0x2e,0x2e,0x34,0x2e,0xa,0x36,0x2e,0x2e,0x31,0x2e,0x35,0x2e,0x2e,0x37,0x2e,0x2e,0x37,0x2e,0x33,0x2e,0x38,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x36,0x2e,0x33,0x39,0x37,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x36,0x2e,0x2e,0x2e,0x34,0x32,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x36,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x38,0x2e,0x32,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x32,0xa,0x37,0x34,0x32,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x31,0x33,0x2e,0x2e,0x2e,0x2e,0x35,0x34,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x38,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x36,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x31,0x33,0xa,0x38,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x34,0x2e,0x37,0x35,0x2e,0x31,0x2e,0x2e,0x2e,0x37,0x33,0x31,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x33,0x2e,0x2e,0x2e,0x31,0x2e,0x2e,0x35,0x2e,0x2e,0x38,0x2e,0x2e,0x2e,0x32,0x31,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x36,0x2e,0x37,0x34,0x2e,0xa,0x2e,0x2e,0x31,0x33,0x2e,0x2e,0x2e,0x34,0x37,0x2e,0x36,0x2e,0x31,0x2e,0x2e,0x39,0x32,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x35,0x32,0x2e,0x37,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x36,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x31,0x2e,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x2e,0x31,0x2e,0x38,0x2e,0x35,0x2e,0x2e,0x34,0x36,0x33,0xa,0x33,0x38,0x2e,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x38,0x2e,0x31,0x2e,0x2e,0x2e,0x39,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x34,0x2e,0x31,0x35,0x37,0x2e,0x2e,0x2e,0x32,0x2e,0x2e,0x2e,0x34,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x37,0x2e,0x2e,0x33,0x2e,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x34,0x31,0x39,0x2e,0x2e,0x2e,0x2e,0x36,0x32,0x35,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x2e,0x32,0x37,0x2e,0xa};
\ No newline at end of file
@@ -2,6 +2,24 @@
 
 #define N 9  // Sudoku grid size (9x9)
 
+#ifdef BATCH
+// Batch of hard puzzles, one per line, 81 cells in row order, '.' or '0'
+// for an empty cell.
+#include "puzzles-txt.h"
+MFILE __infile = {
+  "puzzles.txt",
+  __puzzles_sz,
+  __puzzles,
+  0
+};
+MFILE *infile = &__infile;
+
+#define MAX_PUZZLES 128
+#ifndef BATCH_REPS
+#define BATCH_REPS 1  // Times the batch is solved.
+#endif
+#endif /* BATCH */
+
 // Hard, but solvable, Sudoku puzzle.
 // Zeros indicate empty cells.
 static int board[N][N] = {
@@ -76,6 +94,264 @@ int solveSudoku() {
     return 0;  // Trigger backtracking.
 }
 
+#ifdef SOLVER_BITSET
+// Constraint-propagation solver: the digits used in each row, column and box
+// are kept as 9-bit masks, so the candidates of a cell are found with a few
+// logical operations. Cells with a single candidate (naked singles) are filled
+// until none remain, then the solver branches on the cell with the fewest
+// candidates (minimum remaining values).
+
+typedef struct {
+    int cells[N * N];
+    int rows[N], cols[N], boxes[N];
+} bitset_state_t;
+
+// Count the candidates in a mask.
+static int countBits(int mask) {
+    int count = 0;
+    while (mask) {
+        mask &= mask - 1;
+        count++;
+    }
+    return count;
+}
+
+// Return the lowest digit in a candidate mask.
+static int lowestDigit(int mask) {
+    int digit = 1;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        digit++;
+    }
+    return digit;
+}
+
+// Place digit in cell, returns 0 if it is already used in the row, column or box.
+static int placeDigit(bitset_state_t *s, int cell, int digit) {
+    int row = cell / N, col = cell % N, box = (row / 3) * 3 + col / 3;
+    int bit = 1 << (digit - 1);
+    if ((s->rows[row] | s->cols[col] | s->boxes[box]) & bit)
+        return 0;
+    s->cells[cell] = digit;
+    s->rows[row] |= bit;
+    s->cols[col] |= bit;
+    s->boxes[box] |= bit;
+    return 1;
+}
+
+// Recursively propagate and branch until the state is solved.
+static int solveBitsetState(bitset_state_t *s) {
+    for (;;) {
+        int best = -1, bestCount = N + 1, progress = 0;
+
+        // Fill naked singles, and find the cell with the fewest candidates.
+        for (int i = 0; i < N * N; i++) {
+            if (s->cells[i])
+                continue;
+            int row = i / N, col = i % N, box = (row / 3) * 3 + col / 3;
+            int mask = ~(s->rows[row] | s->cols[col] | s->boxes[box]) & 0x1ff;
+            if (mask == 0)
+                return 0;  // Dead end, no candidates left.
+            if ((mask & (mask - 1)) == 0) {
+                placeDigit(s, i, lowestDigit(mask));
+                progress = 1;
+                continue;
+            }
+            int count = countBits(mask);
+            if (count < bestCount) {
+                bestCount = count;
+                best = i;
+            }
+        }
+        if (progress)
+            continue;
+
+        // No empty cell found; puzzle is solved.
+        if (best < 0)
+            return 1;
+
+        // Try each candidate of the most constrained cell on a copy of the state.
+        int row = best / N, col = best % N, box = (row / 3) * 3 + col / 3;
+        int mask = ~(s->rows[row] | s->cols[col] | s->boxes[box]) & 0x1ff;
+        while (mask) {
+            bitset_state_t trial = *s;
+            int bit = mask & -mask;
+            mask ^= bit;
+            placeDigit(&trial, best, lowestDigit(bit));
+            if (solveBitsetState(&trial)) {
+                *s = trial;
+                return 1;
+            }
+        }
+        return 0;  // Trigger backtracking.
+    }
+}
+
+// Solve the board with the constraint-propagation solver.
+int solveBitset() {
+    bitset_state_t s;
+    libmin_memset(&s, 0, sizeof(s));
+    for (int i = 0; i < N * N; i++) {
+        if (board[i / N][i % N] && !placeDigit(&s, i, board[i / N][i % N]))
+            return 0;  // Conflicting clues.
+    }
+    if (!solveBitsetState(&s))
+        return 0;
+    for (int i = 0; i < N * N; i++)
+        board[i / N][i % N] = s.cells[i];
+    return 1;
+}
+#endif /* SOLVER_BITSET */
+
+#ifdef SOLVER_DLX
+// Dancing-links (Knuth's Algorithm X) solver: sudoku as an exact cover
+// problem, each of the 729 (row, column, digit) choices covers one cell, one
+// row-digit, one column-digit and one box-digit constraint, 324 in total.
+// Columns are chosen smallest first.
+
+#define DLX_COLS (4 * N * N)
+#define DLX_ROWS (N * N * N)
+#define DLX_ROOT DLX_COLS
+#define DLX_NODES (DLX_COLS + 1 + 4 * DLX_ROWS)
+
+static int dlxL[DLX_NODES], dlxR[DLX_NODES], dlxU[DLX_NODES], dlxD[DLX_NODES];
+static int dlxC[DLX_NODES], dlxRow[DLX_NODES], dlxS[DLX_COLS];
+static int dlxRowNode[DLX_ROWS];  // First node of each choice.
+static int dlxSolution[N * N];
+
+// Remove column c from the header list, and its rows from the other columns.
+static void dlxCover(int c) {
+    dlxL[dlxR[c]] = dlxL[c];
+    dlxR[dlxL[c]] = dlxR[c];
+    for (int i = dlxD[c]; i != c; i = dlxD[i]) {
+        for (int j = dlxR[i]; j != i; j = dlxR[j]) {
+            dlxU[dlxD[j]] = dlxU[j];
+            dlxD[dlxU[j]] = dlxD[j];
+            dlxS[dlxC[j]]--;
+        }
+    }
+}
+
+// Undo dlxCover(c), in reverse order.
+static void dlxUncover(int c) {
+    for (int i = dlxU[c]; i != c; i = dlxU[i]) {
+        for (int j = dlxL[i]; j != i; j = dlxL[j]) {
+            dlxS[dlxC[j]]++;
+            dlxU[dlxD[j]] = j;
+            dlxD[dlxU[j]] = j;
+        }
+    }
+    dlxL[dlxR[c]] = c;
+    dlxR[dlxL[c]] = c;
+}
+
+// Build the exact cover matrix for an empty board.
+static void dlxBuild() {
+    for (int c = 0; c <= DLX_COLS; c++) {
+        dlxL[c] = c - 1;
+        dlxR[c] = c + 1;
+        dlxU[c] = dlxD[c] = c;
+        if (c < DLX_COLS)
+            dlxS[c] = 0;
+    }
+    dlxL[0] = DLX_ROOT;
+    dlxR[DLX_ROOT] = 0;
+
+    int node = DLX_COLS + 1;
+    for (int r = 0; r < N; r++) {
+        for (int c = 0; c < N; c++) {
+            for (int d = 0; d < N; d++) {
+                int choice = (r * N + c) * N + d;
+                int cols[4] = {
+                    r * N + c,
+                    N * N + r * N + d,
+                    2 * N * N + c * N + d,
+                    3 * N * N + ((r / 3) * 3 + c / 3) * N + d
+                };
+                dlxRowNode[choice] = node;
+                for (int k = 0; k < 4; k++, node++) {
+                    int col = cols[k];
+                    dlxC[node] = col;
+                    dlxRow[node] = choice;
+                    dlxU[node] = dlxU[col];
+                    dlxD[node] = col;
+                    dlxD[dlxU[col]] = node;
+                    dlxU[col] = node;
+                    dlxS[col]++;
+                    dlxL[node] = k == 0 ? node + 3 : node - 1;
+                    dlxR[node] = k == 3 ? node - 3 : node + 1;
+                }
+            }
+        }
+    }
+}
+
+// Recursively search for an exact cover, with k choices made so far.
+static int dlxSearch(int k) {
+    if (dlxR[DLX_ROOT] == DLX_ROOT)
+        return 1;
+
+    // Choose the column with the fewest rows.
+    int best = dlxR[DLX_ROOT];
+    for (int c = dlxR[best]; c != DLX_ROOT; c = dlxR[c]) {
+        if (dlxS[c] < dlxS[best])
+            best = c;
+    }
+    if (dlxS[best] == 0)
+        return 0;
+
+    dlxCover(best);
+    for (int i = dlxD[best]; i != best; i = dlxD[i]) {
+        dlxSolution[k] = dlxRow[i];
+        for (int j = dlxR[i]; j != i; j = dlxR[j])
+            dlxCover(dlxC[j]);
+        if (dlxSearch(k + 1))
+            return 1;  // The matrix is rebuilt for the next puzzle.
+        for (int j = dlxL[i]; j != i; j = dlxL[j])
+            dlxUncover(dlxC[j]);
+    }
+    dlxUncover(best);
+    return 0;  // Trigger backtracking.
+}
+
+// Solve the board with the dancing-links solver.
+int solveDLX() {
+    int clues = 0;
+    dlxBuild();
+
+    // Select the choices of the clues.
+    for (int i = 0; i < N * N; i++) {
+        int digit = board[i / N][i % N];
+        if (!digit)
+            continue;
+        int row = dlxRowNode[i * N + digit - 1];
+        for (int j = row; j < row + 4; j++) {
+            // A covered column means conflicting clues.
+            if (dlxL[dlxR[dlxC[j]]] != dlxC[j])
+                return 0;
+            dlxCover(dlxC[j]);
+        }
+        dlxSolution[clues++] = i * N + digit - 1;
+    }
+
+    if (!dlxSearch(clues))
+        return 0;
+    for (int k = 0; k < N * N; k++) {
+        int choice = dlxSolution[k];
+        board[choice / (N * N)][(choice / N) % N] = choice % N + 1;
+    }
+    return 1;
+}
+#endif /* SOLVER_DLX */
+
+#if defined(SOLVER_DLX)
+#define SOLVE() solveDLX()
+#elif defined(SOLVER_BITSET)
+#define SOLVE() solveBitset()
+#else
+#define SOLVE() solveSudoku()
+#endif
+
 // Utility function to print the Sudoku board.
 void printBoard() {
     for (int i = 0; i < N; i++) {
@@ -86,18 +362,86 @@ void printBoard() {
     }
 }
 
+#ifdef BATCH
+// Check that the board is a complete solution that keeps the clues.
+int checkBoard(const char *clues) {
+    for (int i = 0; i < N * N; i++) {
+        int digit = board[i / N][i % N];
+        if (clues[i] >= '1' && clues[i] <= '9' && digit != clues[i] - '0')
+            return 0;
+        board[i / N][i % N] = 0;
+        if (digit < 1 || digit > N || !isSafe(i / N, i % N, digit)) {
+            board[i / N][i % N] = digit;
+            return 0;
+        }
+        board[i / N][i % N] = digit;
+    }
+    return 1;
+}
+
+static char puzzles[MAX_PUZZLES][N * N + 1];
+static char solutions[MAX_PUZZLES][N * N + 1];
+
+int main() {
+    char line[128];
+    int count = 0, solved = 0;
+
+    // Read the puzzle batch, skipping blank and comment lines.
+    libmin_mopen(infile, "r");
+    while (count < MAX_PUZZLES && libmin_mgets(line, sizeof(line), infile)) {
+        if (libmin_strlen(line) < N * N || line[0] == '#')
+            continue;
+        libmin_memcpy(puzzles[count], line, N * N);
+        puzzles[count][N * N] = '\0';
+        count++;
+    }
+    libmin_mclose(infile);
+
+    // the rate is this count times BATCH_REPS over the time of the perf
+    // report, the output does not depend on BATCH_REPS
+    libmin_printf("Timing %d puzzles per pass\n", count);
+    libtarg_start_perf();
+    for (int rep = 0; rep < BATCH_REPS; rep++) {
+        solved = 0;
+        for (int p = 0; p < count; p++) {
+            for (int i = 0; i < N * N; i++) {
+                char cell = puzzles[p][i];
+                board[i / N][i % N] = (cell >= '1' && cell <= '9') ? cell - '0' : 0;
+            }
+            if (SOLVE() && checkBoard(puzzles[p])) {
+                for (int i = 0; i < N * N; i++)
+                    solutions[p][i] = '0' + board[i / N][i % N];
+                solved++;
+            }
+            else
+                libmin_strcpy(solutions[p], "no solution");
+        }
+    }
+    libtarg_stop_perf();
+
+    for (int p = 0; p < count; p++)
+        libmin_printf("%3d: %s\n    %s\n", p + 1, puzzles[p], solutions[p]);
+    libmin_printf("\nSolved %d of %d puzzles.\n", solved, count);
+
+    if (solved != count)
+        libtarg_fail(1);
+    libmin_success();
+    return 0;
+}
+#else /* !BATCH */
 int main() {
     libmin_printf("Initial Sudoku Puzzle:\n");
     printBoard();
 
-    if (solveSudoku()) {
+    if (SOLVE()) {
         libmin_printf("\nSolved Sudoku Puzzle:\n");
         printBoard();
-        libtarg_success();
+        libmin_success();
     } else {
         libmin_printf("No solution found.\n");
         libtarg_fail(1);
     }
     return 0;
 }
+#endif /* BATCH */
 
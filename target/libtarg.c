@@ -43,13 +43,15 @@ simple_halt(void)
   simple_halt();
 }
 
-void *
+/* the compiler may emit calls to memset() and memcpy() after link-time
+   optimization, so they must be retained in LTO builds */
+__attribute__((used)) void *
 memset(void *dest, int val, size_t len)
 {
   return libmin_memset(dest, val, len);
 }
 
-void *
+__attribute__((used)) void *
 memcpy(void *dest, const void *src, size_t len)
 {
   return libmin_memcpy(dest, src, len);
@@ -143,13 +145,15 @@ _cva6_exit(int code)
   }
 }
 
-extern inline void *
+/* the compiler may emit calls to memset() and memcpy() after link-time
+   optimization, so they must be retained in LTO builds */
+__attribute__((used)) extern inline void *
 memset(void *dest, int val, size_t len)
 {
   return libmin_memset(dest, val, len);
 }
 
-extern inline void *
+__attribute__((used)) extern inline void *
 memcpy(void *dest, const void *src, size_t len)
 {
   return libmin_memcpy(dest, src, len);
@@ -1,6 +1,32 @@
 // C Program to implement Topological Sorting 
 #include "libmin.h"
 
+#ifdef ALLOC_ARENA
+// Stack and adjacency list nodes are allocated from an arena, and released
+// all at once after the sort
+#define ARENA_SIZE  2048
+static uint8_t arena_buf[ARENA_SIZE];
+static libmin_arena_t arena;
+#define NODE_MALLOC(SZ)  libmin_arena_alloc(&arena, (SZ))
+#define NODE_FREE(P)     ((void)(P))
+#else /* !ALLOC_ARENA */
+#define NODE_MALLOC(SZ)  libmin_malloc(SZ)
+#define NODE_FREE(P)     libmin_free(P)
+#endif /* ALLOC_ARENA */
+
+#ifdef ALLOC_POOL
+// Stack and adjacency list nodes come from contiguous object pools
+#define POOL_SIZE  16
+static libmin_pool_t stack_pool, list_pool;
+#define STACK_MALLOC(SZ)  libmin_pool_alloc(&stack_pool)
+#define STACK_FREE(P)     libmin_pool_free(&stack_pool, (P))
+#define LIST_MALLOC(SZ)   libmin_pool_alloc(&list_pool)
+#else /* !ALLOC_POOL */
+#define STACK_MALLOC(SZ)  NODE_MALLOC(SZ)
+#define STACK_FREE(P)     NODE_FREE(P)
+#define LIST_MALLOC(SZ)   NODE_MALLOC(SZ)
+#endif /* ALLOC_POOL */
+
 // Structure to represent a stack 
 struct Stack { 
     int data; 
@@ -23,7 +49,7 @@ struct List {
 struct Stack *
 createStackNode(int data) 
 { 
-  struct Stack* newNode = (struct Stack*)libmin_malloc(sizeof(struct Stack)); 
+  struct Stack* newNode = (struct Stack*)STACK_MALLOC(sizeof(struct Stack)); 
   newNode->data = data; 
   newNode->next = NULL; 
   return newNode; 
@@ -33,7 +59,7 @@ createStackNode(int data)
 struct List *
 createListNode(int data) 
 { 
-  struct List* newNode = (struct List*)libmin_malloc(sizeof(struct List)); 
+  struct List* newNode = (struct List*)LIST_MALLOC(sizeof(struct List)); 
   newNode->data = data; 
   newNode->next = NULL; 
   return newNode; 
@@ -108,7 +134,7 @@ void topologicalSort(struct Graph* graph)
         libmin_printf("%d ", stack->data); 
         struct Stack* temp = stack; 
         stack = stack->next; 
-        libmin_free(temp); 
+        STACK_FREE(temp); 
     } 
   
     // Free allocated memory 
@@ -121,6 +147,15 @@ void topologicalSort(struct Graph* graph)
 int
 main(void) 
 { 
+#ifdef ALLOC_ARENA
+  libmin_arena_init(&arena, arena_buf, ARENA_SIZE);
+#endif /* ALLOC_ARENA */
+#ifdef ALLOC_POOL
+  if (!libmin_pool_init(&stack_pool, sizeof(struct Stack), POOL_SIZE)
+      || !libmin_pool_init(&list_pool, sizeof(struct List), POOL_SIZE))
+    libmin_fail(1);
+#endif /* ALLOC_POOL */
+
   // Create a graph given in the above diagram 
   struct Graph* g = createGraph(6); 
   addEdge(g, 5, 2); 
@@ -133,6 +168,14 @@ main(void)
   libmin_printf("Topological Sorting Order: "); 
   topologicalSort(g); 
   libmin_printf("\n");
+
+#ifdef ALLOC_ARENA
+  libmin_arena_destroy(&arena);
+#endif /* ALLOC_ARENA */
+#ifdef ALLOC_POOL
+  libmin_pool_destroy(&list_pool);
+  libmin_pool_destroy(&stack_pool);
+#endif /* ALLOC_POOL */
   
   libmin_success();
   return 0; 
@@ -7,6 +7,8 @@
  * - No malloc; static storage
  * - Optional timing via RISC-V rdcycle or portable fallbacks
  * - Produces a simple checksum to verify determinism
+ * - Optional interacting mode (VB_LJ): Lennard-Jones particles with cell and
+ *   Verlet neighbor lists, in a structure-of-arrays layout
  *
  * You can compile this as freestanding or hosted. If printf is unavailable,
  * define NO_STDIO and the code will avoid it (writes checksum to a volatile).
@@ -15,6 +17,18 @@
 #include "libmin.h"
 
 /* ---------------- Tunables (override via -D…) ---------------- */
+#ifdef VB_LJ
+#ifndef VB_N
+#define VB_N  4096       /* number of particles, scales to 100000 and beyond */
+#endif
+#ifndef VB_DT
+#define VB_DT  5.0e-3     /* time step, in Lennard-Jones units */
+#endif
+#ifndef VB_DIM
+#define VB_DIM 3          /* 2 or 3 */
+#endif
+#endif /* VB_LJ */
+
 #ifndef VB_N
 #define VB_N  128        /* number of particles */
 #endif
@@ -35,6 +49,22 @@
 #define VB_DIM 2          /* 1, 2, or 3 (we store 2D when VB_DIM==2) */
 #endif
 
+#ifndef VB_RHO
+#define VB_RHO  0.8       /* VB_LJ: number density */
+#endif
+
+#ifndef VB_RC
+#define VB_RC   2.5       /* VB_LJ: pair potential cutoff radius */
+#endif
+
+#ifndef VB_SKIN
+#define VB_SKIN 0.3       /* VB_LJ: neighbor list skin beyond the cutoff */
+#endif
+
+#ifndef VB_MAXNEIGH
+#define VB_MAXNEIGH 64    /* VB_LJ: average half-list neighbors per particle */
+#endif
+
 #ifndef VB_FP
 #define VB_FP double      /* float or double */
 #endif
@@ -64,6 +94,7 @@ static VB_FP a[VB_N * VB_DIM];   /* accelerations */
      a(t+dt) = -k * x(t+dt)
      v(t+dt) = v(t) + 0.5*(a(t) + a(t+dt))*dt
 */
+#ifndef VB_LJ
 static void vb_init(void) {
   uint32_t rng = 0x12345678u;
   for (int i = 0; i < VB_N; ++i) {
@@ -112,6 +143,208 @@ static void vb_step_avg(VB_FP dt) {
     }
   }
 }
+#endif /* !VB_LJ */
+
+#ifdef VB_LJ
+/* ---------------- Lennard-Jones interacting mode ----------------
+   Particles in a periodic box at density VB_RHO interact through the
+   Lennard-Jones potential (sigma = epsilon = m = 1), cut off at VB_RC:
+     a_i = sum_j 24 * (2/r^12 - 1/r^6) / r^2 * (x_i - x_j)
+   x, v and a are stored as structure of arrays, coordinate d of particle i
+   at [d*VB_N + i]. Pairs come from a half Verlet neighbor list of radius
+   VB_RC + VB_SKIN, built by binning the particles into cells at least that
+   wide, and rebuilt once a particle has moved more than half the skin.
+   Integration is velocity Verlet, as in vb_step_avg().
+*/
+#define VB_IDX(d, i)  ((d)*VB_N + (i))
+
+static VB_FP a_prev[VB_N * VB_DIM];         /* accelerations of the last step */
+static VB_FP x0[VB_N * VB_DIM];             /* positions at the last list build */
+static int   cell_start[VB_N + 1];          /* first particle of each cell,
+                                               at most VB_N cells */
+static int   cell_list[VB_N];               /* particles sorted by cell */
+static int   cell_of[VB_N];                 /* cell of each particle */
+static int   nbr_start[VB_N + 1];           /* first neighbor of each particle */
+static int   nbr_list[VB_N * VB_MAXNEIGH];  /* neighbors j > i, by particle i */
+static VB_FP box;                           /* side of the periodic box */
+static int   ncell;                         /* cells per side */
+static int   vb_rebuilds;
+
+/* separation of two coordinates, for the nearest periodic image */
+static inline VB_FP vb_min_image(VB_FP dx) {
+  const VB_FP half = (VB_FP)0.5 * box;
+  if (dx > half) dx -= box;
+  else if (dx < -half) dx += box;
+  return dx;
+}
+
+static void vb_build_lists(void) {
+  const VB_FP rl = (VB_FP)(VB_RC + VB_SKIN);
+  int cells = 1;
+  for (int d = 0; d < VB_DIM; ++d) cells *= ncell;
+
+  /* wrap the particles into the box, and bin them by cell */
+  for (int c = 0; c <= cells; ++c) cell_start[c] = 0;
+  for (int i = 0; i < VB_N; ++i) {
+    int c = 0;
+    for (int d = VB_DIM - 1; d >= 0; --d) {
+      VB_FP *p = &x[VB_IDX(d, i)];
+      while (*p < 0) *p += box;
+      while (*p >= box) *p -= box;
+      x0[VB_IDX(d, i)] = *p;
+      int k = (int)(*p * (VB_FP)ncell / box);
+      c = c * ncell + ((k < ncell) ? k : ncell - 1);
+    }
+    cell_of[i] = c;
+    cell_start[c + 1]++;
+  }
+  for (int c = 0; c < cells; ++c) cell_start[c + 1] += cell_start[c];
+  for (int i = 0; i < VB_N; ++i) cell_list[cell_start[cell_of[i]]++] = i;
+  for (int c = cells; c > 0; --c) cell_start[c] = cell_start[c - 1];
+  cell_start[0] = 0;
+
+  /* pairs j > i within rl, from the 3^VB_DIM cells around the cell of i,
+     which are all distinct as there are at least 3 cells per side */
+  int stencil = 1;
+  for (int d = 0; d < VB_DIM; ++d) stencil *= 3;
+  int n = 0;
+  for (int i = 0; i < VB_N; ++i) {
+    int ci[VB_DIM];
+    for (int d = 0, c = cell_of[i]; d < VB_DIM; ++d, c /= ncell) ci[d] = c % ncell;
+    nbr_start[i] = n;
+    for (int o = 0; o < stencil; ++o) {
+      int c = 0, pow3 = stencil;
+      for (int d = VB_DIM - 1; d >= 0; --d) {
+        pow3 /= 3;
+        int off = (o / pow3) % 3 - 1;
+        c = c * ncell + (ci[d] + off + ncell) % ncell;
+      }
+      for (int k = cell_start[c]; k < cell_start[c + 1]; ++k) {
+        int j = cell_list[k];
+        if (j <= i) continue;
+        VB_FP r2 = 0;
+        for (int d = 0; d < VB_DIM; ++d) {
+          VB_FP dx = vb_min_image(x[VB_IDX(d, i)] - x[VB_IDX(d, j)]);
+          r2 += dx * dx;
+        }
+        if (r2 < rl * rl) {
+          if (n == VB_N * VB_MAXNEIGH) {
+            libmin_printf("ERROR: neighbor list full, increase VB_MAXNEIGH\n");
+            libmin_fail(1);
+          }
+          nbr_list[n++] = j;
+        }
+      }
+    }
+  }
+  nbr_start[VB_N] = n;
+  vb_rebuilds++;
+}
+
+/* Lennard-Jones accelerations: gather over the neighbors of each particle,
+   and scatter the opposite force onto them */
+static void vb_lj_accel(void) {
+  const VB_FP rc2 = (VB_FP)(VB_RC * VB_RC);
+  for (int i = 0; i < VB_N * VB_DIM; ++i) a[i] = 0;
+
+  for (int i = 0; i < VB_N; ++i) {
+    VB_FP xi[VB_DIM], ai[VB_DIM];
+    for (int d = 0; d < VB_DIM; ++d) {
+      xi[d] = x[VB_IDX(d, i)];
+      ai[d] = 0;
+    }
+    for (int k = nbr_start[i]; k < nbr_start[i + 1]; ++k) {
+      int j = nbr_list[k];
+      VB_FP dx[VB_DIM], r2 = 0;
+      for (int d = 0; d < VB_DIM; ++d) {
+        dx[d] = vb_min_image(xi[d] - x[VB_IDX(d, j)]);
+        r2 += dx[d] * dx[d];
+      }
+      if (r2 >= rc2) continue;
+      VB_FP inv2 = (VB_FP)1.0 / r2;
+      VB_FP inv6 = inv2 * inv2 * inv2;
+      VB_FP f = (VB_FP)24.0 * inv2 * inv6 * ((VB_FP)2.0 * inv6 - (VB_FP)1.0);
+      for (int d = 0; d < VB_DIM; ++d) {
+        ai[d] += f * dx[d];
+        a[VB_IDX(d, j)] -= f * dx[d];
+      }
+    }
+    for (int d = 0; d < VB_DIM; ++d) a[VB_IDX(d, i)] += ai[d];
+  }
+}
+
+static void vb_lj_init(void) {
+  uint32_t rng = 0x12345678u;
+
+  /* box of volume VB_N / VB_RHO, at least 3 cells of the list radius wide */
+  box = (VB_FP)libmin_pow((double)VB_N / VB_RHO, 1.0 / VB_DIM);
+  ncell = (int)(box / (VB_FP)(VB_RC + VB_SKIN));
+  /* at low density, wider cells keep the number of cells within VB_N */
+  for (;;) {
+    long cells = 1;
+    for (int d = 0; d < VB_DIM; ++d) cells *= ncell;
+    if (cells <= VB_N) break;
+    ncell--;
+  }
+  if (ncell < 3) {
+    libmin_printf("ERROR: box too small for cell lists, increase VB_N\n");
+    libmin_fail(1);
+  }
+
+  /* particles on a simple cubic lattice, slightly displaced, with random
+     velocities of zero total momentum */
+  int side = 1;
+  for (;;) {
+    long sites = 1;
+    for (int d = 0; d < VB_DIM; ++d) sites *= side;
+    if (sites >= VB_N) break;
+    side++;
+  }
+  VB_FP spacing = box / (VB_FP)side;
+  VB_FP vsum[VB_DIM];
+  for (int d = 0; d < VB_DIM; ++d) vsum[d] = 0;
+  for (int i = 0; i < VB_N; ++i) {
+    for (int d = 0, site = i; d < VB_DIM; ++d, site /= side) {
+      VB_FP jitter = (vb_urand(&rng) - (VB_FP)0.5) * (VB_FP)0.1;
+      x[VB_IDX(d, i)] = ((VB_FP)(site % side) + (VB_FP)0.5 + jitter) * spacing;
+      v[VB_IDX(d, i)] = vb_urand(&rng) - (VB_FP)0.5;
+      vsum[d] += v[VB_IDX(d, i)];
+    }
+  }
+  for (int d = 0; d < VB_DIM; ++d) {
+    for (int i = 0; i < VB_N; ++i) v[VB_IDX(d, i)] -= vsum[d] / (VB_FP)VB_N;
+  }
+
+  vb_build_lists();
+  vb_lj_accel();
+}
+
+static void vb_lj_step(VB_FP dt) {
+  const VB_FP half_dt2 = (VB_FP)0.5 * dt * dt;
+  const VB_FP limit = (VB_FP)(0.5 * VB_SKIN) * (VB_FP)(0.5 * VB_SKIN);
+
+  /* x update, tracking the largest move since the last list build */
+  VB_FP max_d2 = 0;
+  for (int i = 0; i < VB_N * VB_DIM; ++i) {
+    a_prev[i] = a[i];
+    x[i] = x[i] + v[i]*dt + a[i]*half_dt2;
+  }
+  for (int i = 0; i < VB_N; ++i) {
+    VB_FP d2 = 0;
+    for (int d = 0; d < VB_DIM; ++d) {
+      VB_FP dx = x[VB_IDX(d, i)] - x0[VB_IDX(d, i)];
+      d2 += dx * dx;
+    }
+    if (d2 > max_d2) max_d2 = d2;
+  }
+  if (max_d2 > limit) vb_build_lists();
+
+  /* a_new, then v update with average accel */
+  vb_lj_accel();
+  for (int i = 0; i < VB_N * VB_DIM; ++i)
+    v[i] = v[i] + ((a_prev[i] + a[i]) * (VB_FP)0.5) * dt;
+}
+#endif /* VB_LJ */
 
 /* ---------------- Checksum for correctness ---------------- */
 static uint64_t vb_checksum(void) {
@@ -133,6 +366,24 @@ static uint64_t vb_checksum(void) {
 volatile uint64_t vb_sink; /* for NO_STDIO mode */
 
 int main(void) {
+#ifdef VB_LJ
+  vb_lj_init();
+
+  libtarg_start_perf();
+  for (int s = 0; s < VB_STEPS; ++s) {
+    vb_lj_step((VB_FP)VB_DT);
+  }
+  libtarg_stop_perf();
+  uint64_t sum = vb_checksum();
+
+  libmin_printf("verlet-lj: N=%d steps=%d dt=%.4f rho=%.2f rc=%.2f dim=%d fp=%s\n",
+         VB_N, VB_STEPS, (double)VB_DT, (double)VB_RHO, (double)VB_RC, VB_DIM,
+         (sizeof(VB_FP)==sizeof(double)) ? "double" : "float");
+#ifdef VB_STATS
+  libmin_printf("lists: %d builds, %d cells per side, %d pairs in the last\n",
+         vb_rebuilds, ncell, nbr_start[VB_N]);
+#endif
+#else /* !VB_LJ */
   vb_init();
 
   for (int s = 0; s < VB_STEPS; ++s) {
@@ -143,6 +394,7 @@ int main(void) {
   libmin_printf("verlet2d: N=%d steps=%d dt=%g k=%g dim=%d fp=%s\n",
          VB_N, VB_STEPS, (double)VB_DT, (double)VB_K, VB_DIM,
          (sizeof(VB_FP)==sizeof(double)) ? "double" : "float");
+#endif /* VB_LJ */
   libmin_printf("checksum=0x%08x%08x\n", (uint32_t)((sum >> 32)), (uint32_t)(sum & (uint32_t)0xffffffffU));
 
   libmin_success();